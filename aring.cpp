@@ -0,0 +1,849 @@
+/*
+    aring.cpp
+    Andrew J Wood
+
+    slave file to aring.h
+
+    Implementation of the ArrayRing<T,R> API, except for the macro-mutators
+    (mutators of entire list), which are in aring_macro.cpp
+*/
+
+//----------------------------------
+//     ArrayRing<T,R>:: Implementations
+//----------------------------------
+
+// stand-alone functions
+
+template < typename T , class R >
+bool operator == (const ArrayRing<T,R>& x1, const ArrayRing<T,R>& x2)
+{
+  if (x1.Size() != x2.Size())
+    return 0;
+  typename ArrayRing<T,R>::ConstIterator i1 = x1.Begin(), i2 = x2.Begin();
+  for ( ; i1 != x1.End(); ++i1, ++i2)
+  {
+    if (*i1 != *i2)
+      return 0;
+  }
+  return 1;
+}
+
+template < typename T , class R >
+bool operator != (const ArrayRing<T,R>& x1, const ArrayRing<T,R>& x2)
+{
+  return !(x1 == x2);
+}
+
+template < typename T , class R >
+std::ostream& operator << (std::ostream& os, const ArrayRing<T,R>& x2)
+{
+  x2.Display(os);
+  return os;
+}
+
+// end stand-alone functions */
+
+// memory allocator and other private methods
+
+template < typename T , class R >
+void ArrayRing<T,R>::Init ()
+// an array of two slots, the head and the tail; the list cannot run without one
+{
+  data_ = new(std::nothrow) T [2];
+  if (nullptr == data_)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    exit (EXIT_FAILURE);
+  }
+  mask_ = 1;
+  head_ = 0;
+  size_ = 0;
+  retain_.Allocated(2);
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::Resize (size_t slots)
+// moves the elements to slots 1 .. size_ of a new array; slots is a power of 2
+// greater than size_ + 1. The new unused slots hold T().
+{
+  T * newData = new(std::nothrow) T [slots];
+  if (nullptr == newData)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    return 0;
+  }
+  for (size_t k = 0; k < size_; ++k)
+    newData[1 + k] = std::move(At(k));
+  if (slots > mask_ + 1)
+    retain_.Allocated(slots - mask_ - 1);
+  delete [] data_;
+  data_ = newData;
+  mask_ = slots - 1;
+  head_ = 0;
+  return 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::Grow ()
+{
+  return Resize(2 * (mask_ + 1));
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Retain ()
+// asks the retention policy how many unused slots to give back after a removal
+{
+  size_t excess = Excess();
+  size_t n = retain_.Trim(size_, excess);
+  if (n > excess) n = excess;
+  if (n > 0)
+    retain_.Freed(ShrinkToFit(excess - n));
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::InsertAt (size_t k, T&& t)
+// t becomes element k, the elements on the shorter side of k moving one slot
+// outward; returns 0 if the array had to grow and could not
+{
+  if (Full() && !Grow())
+    return 0;
+  if (k < size_ - k) // front side: head_ moves back one slot
+  {
+    for (size_t j = 0; j < k; ++j)
+      data_[(head_ + j) & mask_] = std::move(At(j));
+    data_[(head_ + k) & mask_] = std::move(t);
+    head_ = (head_ - 1) & mask_;
+  }
+  else // back side: the tail slot takes the last element
+  {
+    for (size_t j = size_; j > k; --j)
+      At(j) = std::move(At(j - 1));
+    At(k) = std::move(t);
+  }
+  ++size_;
+  return 1;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::EraseAt (size_t k)
+// element k leaves, the elements on the shorter side of k moving one slot
+// inward; the removed value ends in the slot given up, as a spare value
+{
+  T removed = std::move(At(k));
+  if (k < size_ - 1 - k) // front side: the first slot becomes the head
+  {
+    for (size_t j = k; j > 0; --j)
+      At(j) = std::move(At(j - 1));
+    At(0) = std::move(removed);
+    head_ = Slot(0);
+  }
+  else // back side: the last slot becomes the tail
+  {
+    for (size_t j = k; j + 1 < size_; ++j)
+      At(j) = std::move(At(j + 1));
+    At(size_ - 1) = std::move(removed);
+  }
+  --size_;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Append (const ArrayRing<T,R>& list)
+{
+  if (list.size_ > Excess())
+    Reserve(list.size_);
+  for (size_t k = 0; k < list.size_; ++k)
+    PushBack(list.At(k));
+}
+
+// constructors and assignment
+
+template < typename T , class R >
+ArrayRing<T,R>::ArrayRing () : data_(nullptr), mask_(0), head_(0), size_(0), retain_()
+{
+  Init();
+}
+
+template < typename T , class R >
+ArrayRing<T,R>::ArrayRing (T fill) : data_(nullptr), mask_(0), head_(0), size_(0), retain_()
+// development constructor: head and tail hold fill
+{
+  Init();
+  data_[0] = fill;
+  data_[1] = fill;
+}
+
+template < typename T , class R >
+ArrayRing<T,R>::~ArrayRing ()
+{
+  delete [] data_;
+}
+
+template < typename T , class R >
+ArrayRing<T,R>::ArrayRing (const ArrayRing<T,R>& x)
+  : data_(nullptr), mask_(0), head_(0), size_(0), retain_(x.retain_)
+{
+  Init();
+  Append(x);
+}
+
+template < typename T , class R >
+ArrayRing<T,R>::ArrayRing (ArrayRing<T,R>&& x)
+  : data_(x.data_), mask_(x.mask_), head_(x.head_), size_(x.size_), retain_(x.retain_)
+// takes the array of x and gives x a fresh empty one
+{
+  x.Init();
+}
+
+template < typename T , class R >
+ArrayRing<T,R>& ArrayRing<T,R>::operator = (const ArrayRing<T,R>& rhs)
+// reuses the array when it is large enough
+{
+  if (this != &rhs)
+  {
+    Clear();
+    Append(rhs);
+  }
+  return *this;
+}
+
+template < typename T , class R >
+ArrayRing<T,R>& ArrayRing<T,R>::operator = (ArrayRing<T,R>&& rhs)
+{
+  std::swap(data_, rhs.data_);
+  std::swap(mask_, rhs.mask_);
+  std::swap(head_, rhs.head_);
+  std::swap(size_, rhs.size_);
+  std::swap(retain_, rhs.retain_);
+  return *this;
+}
+
+template < typename T , class R >
+ArrayRing<T,R> * ArrayRing<T,R>::Clone () const
+{
+  return new ArrayRing(*this);
+}
+
+// modifying the list - mutators
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PushFront (const T& t)
+{
+  if (Full())
+    return PushFront(T(t)); // t may be an element, which Grow moves
+  data_[head_] = t;
+  head_ = (head_ - 1) & mask_;
+  ++size_;
+  return 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PushBack (const T& t)
+{
+  if (Full())
+    return PushBack(T(t));
+  At(size_) = t;
+  ++size_;
+  return 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PushFront (T&& t)
+{
+  if (Full() && !Grow())
+    return 0;
+  data_[head_] = std::move(t);
+  head_ = (head_ - 1) & mask_;
+  ++size_;
+  return 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PushBack (T&& t)
+{
+  if (Full() && !Grow())
+    return 0;
+  At(size_) = std::move(t);
+  ++size_;
+  return 1;
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::Insert (ArrayRingIterator<T,R> i, const T& t)
+// t goes in front of i; i may be End() but not rEnd()
+{
+  if (Empty())
+    i = End();
+  if (i.ring_ != this || !i.Valid() || i.slot_ == head_)
+  {
+    std::cerr << " ** cannot insert at position -1\n";
+    return End();
+  }
+  size_t k = Index(i.slot_);
+  if (!InsertAt(k, T(t))) // a copy, since t may be an element that moves
+    return End();
+  return Iterator(this, Slot(k));
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::Insert (ConstArrayRingIterator<T,R> i, const T& t)
+{
+  return Insert(Iterator(i.ring_, i.slot_), t);
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::Insert (const T& t)
+{
+  return Insert(End(), t);
+}
+
+template < typename T , class R >
+ArrayRing<T,R>& ArrayRing<T,R>::operator += (const ArrayRing<T,R>& list)
+{
+  if (this != &list)
+    Append(list);
+  return *this;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PopFront ()
+// the first slot becomes the head, keeping the value it held
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopFront() called on empty list\n";
+    return 0;
+  }
+  head_ = Slot(0);
+  --size_;
+  Retain();
+  return 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::PopBack ()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopBack() called on empty list\n";
+    return 0;
+  }
+  --size_;
+  Retain();
+  return 1;
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::Remove (ArrayRingIterator<T,R> i)
+// returns the position of the element that followed i, or End()
+{
+  if (i.ring_ != this || !i.Valid() || Index(i.slot_) >= size_)
+  {
+    std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
+    return i;
+  }
+  size_t k = Index(i.slot_);
+  EraseAt(k);
+  Retain();
+  return Iterator(this, Slot(k)); // after Retain, which may move the elements
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::Remove (ConstArrayRingIterator<T,R> i)
+{
+  return Remove(Iterator(i.ring_, i.slot_));
+}
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::Remove (const T& t)
+// one pass: the elements kept move forward over the gaps, and the removed
+// values collect after them as spare values; the policy is asked once
+{
+  size_t n = 0;
+  for (size_t k = 0; k < size_; ++k)
+  {
+    if (At(k) == t)
+      continue;
+    if (n != k)
+      std::swap(At(n), At(k));
+    ++n;
+  }
+  size_t count = size_ - n;
+  size_ = n;
+  if (count > 0)
+    Retain();
+  return count;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Clear ()
+{
+  size_ = 0;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Release ()
+{
+  Clear();
+  if (mask_ > 1)
+    Resize(2);
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::Reserve (size_t n)
+// grows the array to the power of 2 that holds the elements, n unused slots,
+// head and tail
+{
+  if (Excess() >= n)
+    return 1;
+  size_t slots = 2 * (mask_ + 1);
+  while (slots < size_ + n + 2)
+    slots *= 2;
+  return Resize(slots);
+}
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::ShrinkToFit (size_t keep)
+{
+  size_t old = mask_ + 1, slots = old;
+  while (slots > 2 && slots / 2 >= size_ + keep + 2)
+    slots /= 2;
+  if (slots == old || !Resize(slots))
+    return 0;
+  return old - slots;
+}
+
+template < typename T , class R >
+R& ArrayRing<T,R>::Retention ()
+{
+  return retain_;
+}
+
+template < typename T , class R >
+const R& ArrayRing<T,R>::Retention () const
+{
+  return retain_;
+}
+
+// information about the list - accessors
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::Size () const
+{
+  return size_;
+}
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::Excess () const
+{
+  return mask_ - 1 - size_;
+}
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::Capacity () const
+{
+  return mask_ - 1;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::Empty () const
+{
+  return size_ == 0;
+}
+
+template < typename T , class R >
+bool ArrayRing<T,R>::Full () const
+{
+  return size_ + 1 == mask_;
+}
+
+template < typename T , class R >
+fsu::ListStats ArrayRing<T,R>::Stats () const
+// a slot counts as a link; every slot holds a T, so all are payload [2]
+{
+  fsu::ListStats s;
+  s.elements    = size_;
+  s.links       = size_;
+  s.spares      = Excess();
+  s.sentinels   = 2;
+  s.linkBytes   = (mask_ + 1) * sizeof(T);
+  s.objectBytes = sizeof(*this);
+  s.sparesKeepValues = 1;
+  if (fsu::PayloadBytes<T>::deep)
+  {
+    for (size_t j = 0; j <= mask_; ++j)
+      s.payloadBytes += fsu::PayloadBytes<T>::Bytes(data_[j]);
+    size_t active = 0;
+    for (size_t k = 0; k < size_; ++k)
+      active += fsu::PayloadBytes<T>::Bytes(At(k));
+    s.retainedBytes = s.payloadBytes - active;
+  }
+  return s;
+}
+
+template < typename T , class R >
+size_t ArrayRing<T,R>::MemoryUsage () const
+{
+  return Stats().Bytes();
+}
+
+template < typename T , class R >
+T& ArrayRing<T,R>::Front ()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return At(0);
+}
+
+template < typename T , class R >
+const T& ArrayRing<T,R>::Front () const
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return At(0);
+}
+
+template < typename T , class R >
+T& ArrayRing<T,R>::Back ()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return At(size_ - 1); // the head slot when empty, as *rBegin()
+}
+
+template < typename T , class R >
+const T& ArrayRing<T,R>::Back () const
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return At(size_ - 1); // the head slot when empty, as *rBegin()
+}
+
+// generic display methods
+
+template < typename T , class R >
+void ArrayRing<T,R>::Display (std::ostream& os, char ofc) const
+{
+  if (ofc == '\0')
+    for (size_t k = 0; k < size_; ++k)
+      os << At(k);
+  else
+    for (size_t k = 0; k < size_; ++k)
+      os << ofc << At(k);
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Dump (std::ostream& os, char ofc) const
+// the elements, the tail, the unused slots and the head, as in alt2c::List
+{
+  if (ofc == '\0')
+    for (size_t k = 0; k <= mask_; ++k)
+      os << At(k);
+  else
+    for (size_t k = 0; k <= mask_; ++k)
+      os << ofc << At(k);
+  os << '\n';
+}
+
+// structural integrity check
+
+template < typename T , class R >
+void ArrayRing<T,R>::CheckLinks (std::ostream& os) const
+{
+  size_t slots = mask_ + 1;
+  if (data_ == nullptr)
+  {
+    os << " ** array missing\n";
+    return;
+  }
+  if (slots < 2 || (slots & mask_) != 0)
+  {
+    os << " ** array size " << slots << " is not a power of 2\n";
+  }
+  if (head_ > mask_)
+  {
+    os << " ** head slot " << head_ << " outside array of " << slots << '\n';
+  }
+  if (size_ + 2 > slots)
+  {
+    os << " ** slot count mismatch: slots = " << slots << " , size = " << size_ << '\n';
+  }
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::CheckIters (std::ostream& os) const
+{
+  ConstIterator i,j,k;
+  size_t n = 0;
+  for (i = this->Begin(), n = 0; i != this->End(); ++i, ++n)
+  {
+    j = i; --j; ++j;
+    k = i; ++k; --k;
+    if (!i.Valid() || !j.Valid() || !k.Valid() || i != j || i != k)
+    {
+      os << " ** forward reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+  if (n != Size())
+  {
+    os << " ** Size() mismatch in forward check: count = " << n << " , size = " << Size() << '\n';
+  }
+  for (i = this->rBegin(), n = 0; i != this->rEnd(); --i, ++n)
+  {
+    j = i; --j; ++j;
+    k = i; ++k; --k;
+    if (!i.Valid() || !j.Valid() || !k.Valid() || i != j || i != k)
+    {
+      os << " ** reverse reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+  if (n != Size())
+  {
+    os << " ** Size() mismatch in reverse check: count = " << n << " , size = " << Size() << '\n';
+  }
+}
+
+// iterator support
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::Begin ()
+{
+  return Iterator(this, Slot(0));
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::End ()
+{
+  return Iterator(this, Slot(size_));
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::rBegin ()
+{
+  return Iterator(this, Slot(size_ - 1));
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::rEnd ()
+{
+  return Iterator(this, head_);
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRing<T,R>::Includes (const T& t)
+// sequential search
+{
+  size_t k = 0;
+  while (k < size_ && !(At(k) == t))
+    ++k;
+  return Iterator(this, Slot(k));
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::Begin () const
+{
+  return ConstIterator(this, Slot(0));
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::End () const
+{
+  return ConstIterator(this, Slot(size_));
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::rBegin () const
+{
+  return ConstIterator(this, Slot(size_ - 1));
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::rEnd () const
+{
+  return ConstIterator(this, head_);
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ArrayRing<T,R>::Includes (const T& t) const
+{
+  size_t k = 0;
+  while (k < size_ && !(At(k) == t))
+    ++k;
+  return ConstIterator(this, Slot(k));
+}
+
+//----------------------------------
+//     ConstArrayRingIterator<T,R>:: Implementations
+//----------------------------------
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>::ConstArrayRingIterator () : ring_(nullptr), slot_(0)
+{}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>::ConstArrayRingIterator (const ArrayRing<T,R> * ring, size_t slot)
+  : ring_(ring), slot_(slot)
+{}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>::ConstArrayRingIterator (const ConstArrayRingIterator<T,R>& i)
+  : ring_(i.ring_), slot_(i.slot_)
+{}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>& ConstArrayRingIterator<T,R>::operator = (const ConstArrayRingIterator<T,R>& i)
+{
+  ring_ = i.ring_;
+  slot_ = i.slot_;
+  return *this;
+}
+
+template < typename T , class R >
+T& ConstArrayRingIterator<T,R>::Retrieve () const
+// any slot of the array may be read, as any link of the ring may [3]
+{
+  if (ring_ == nullptr || slot_ > ring_->mask_)
+  {
+    std::cerr << "** Error: ConstArrayRingIterator<T>::Retrieve() invalid dereference\n";
+    exit (EXIT_FAILURE);
+  }
+  return ring_->data_[slot_];
+}
+
+template < typename T , class R >
+bool ConstArrayRingIterator<T,R>::Valid () const
+{
+  if (ring_ == nullptr || slot_ > ring_->mask_)
+    return 0;
+  size_t k = ring_->Index(slot_);
+  return k <= ring_->size_ || k == ring_->mask_;
+}
+
+template < typename T , class R >
+bool ConstArrayRingIterator<T,R>::operator == (const ConstArrayRingIterator<T,R>& i2) const
+{
+  return ring_ == i2.ring_ && slot_ == i2.slot_;
+}
+
+template < typename T , class R >
+bool ConstArrayRingIterator<T,R>::operator != (const ConstArrayRingIterator<T,R>& i2) const
+{
+  return !(*this == i2);
+}
+
+template < typename T , class R >
+const T& ConstArrayRingIterator<T,R>::operator * () const
+{
+  return Retrieve();
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>& ConstArrayRingIterator<T,R>::operator ++ ()
+{
+  if (ring_ != nullptr && slot_ <= ring_->mask_)
+    slot_ = (slot_ + 1) & ring_->mask_;
+  return *this;
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ConstArrayRingIterator<T,R>::operator ++ (int)
+{
+  ConstArrayRingIterator<T,R> clone = *this;
+  this->operator++();
+  return clone;
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R>& ConstArrayRingIterator<T,R>::operator -- ()
+{
+  if (ring_ != nullptr && slot_ <= ring_->mask_)
+    slot_ = (slot_ - 1) & ring_->mask_;
+  return *this;
+}
+
+template < typename T , class R >
+ConstArrayRingIterator<T,R> ConstArrayRingIterator<T,R>::operator -- (int)
+{
+  ConstArrayRingIterator<T,R> clone = *this;
+  this->operator--();
+  return clone;
+}
+
+//----------------------------------
+//     ArrayRingIterator<T,R>:: Implementations
+//----------------------------------
+
+template < typename T , class R >
+ArrayRingIterator<T,R>::ArrayRingIterator () : ConstArrayRingIterator<T,R>()
+{}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>::ArrayRingIterator (ArrayRing<T,R>& x) : ConstArrayRingIterator<T,R>(&x, x.Slot(0))
+{}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>::ArrayRingIterator (const ArrayRing<T,R> * ring, size_t slot)
+  : ConstArrayRingIterator<T,R>(ring, slot)
+{}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>::ArrayRingIterator (const ArrayRingIterator<T,R>& i) : ConstArrayRingIterator<T,R>(i)
+{}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>& ArrayRingIterator<T,R>::operator = (const ArrayRingIterator<T,R>& i)
+{
+  ConstArrayRingIterator<T,R>::operator=(i);
+  return *this;
+}
+
+template < typename T , class R >
+T& ArrayRingIterator<T,R>::operator * ()
+{
+  return ConstArrayRingIterator<T,R>::Retrieve();
+}
+
+template < typename T , class R >
+const T& ArrayRingIterator<T,R>::operator * () const
+{
+  return ConstArrayRingIterator<T,R>::Retrieve();
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>& ArrayRingIterator<T,R>::operator ++ ()
+{
+  ConstArrayRingIterator<T,R>::operator++();
+  return *this;
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRingIterator<T,R>::operator ++ (int)
+{
+  ArrayRingIterator<T,R> clone = *this;
+  this->operator++();
+  return clone;
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R>& ArrayRingIterator<T,R>::operator -- ()
+{
+  ConstArrayRingIterator<T,R>::operator--();
+  return *this;
+}
+
+template < typename T , class R >
+ArrayRingIterator<T,R> ArrayRingIterator<T,R>::operator -- (int)
+{
+  ArrayRingIterator<T,R> clone = *this;
+  this->operator--();
+  return clone;
+}
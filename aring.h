@@ -0,0 +1,304 @@
+/*
+    aring.h
+    Andrew J Wood
+
+    Definition of the alt2c::ArrayRing<T,R> API
+
+    The ring buffer model of alt2c::List (list2c.h) on one contiguous array
+    instead of a ring of links. The elements occupy consecutive slots of a
+    power-of-two array, modulo its size; head_ is the slot one before the
+    first element and the slot one past the last plays the part of tail_.
+    Pushes and pops move these two indices, so a queue or deque touches
+    memory in order and never follows a pointer. The public interface is
+    that of list2c.api, so a client can switch with a single typedef:
+
+      typedef alt2c::List < ElementType >       ContainerType;
+      typedef alt2c::ArrayRing < ElementType >  ContainerType;
+
+    The array always keeps two slots for head and tail, as the ring keeps
+    two links, so Capacity() is the array size less 2 and Excess() the
+    unused slots. A push onto a Full() ring doubles the array. Insert and
+    Remove in the middle shift the elements on the shorter side of the
+    position by one slot, so they cost min(k, Size() - k) moves [1].
+
+    The second template argument is a retention policy from retention.h,
+    as for alt2c::List. Its counts are in slots: Allocations() counts the
+    slots gained by growing, Trimmed() those given back on its advice.
+    After a removal that the policy answers with a trim, the array is
+    halved as often as the remaining elements and kept spares allow [2].
+*/
+
+#ifndef _ARING_H
+#define _ARING_H
+
+#include <iostream>    // class ostream and objects cerr, cout
+#include <cstdlib>     // EXIT_FAILURE, size_t
+#include <new>         // std::nothrow
+#include <utility>     // std::move, std::swap
+#include <compare.h>   // needed for Sort()
+#include <liststats.h> // fsu::ListStats, fsu::PayloadBytes
+#include <retention.h> // retention policies alt2c::KeepAll, FractionRetention, DecayRetention
+
+namespace alt2c
+{
+
+  template < typename T , class R = KeepAll >
+  class ArrayRing;
+
+  template < typename T , class R = KeepAll >
+  class ConstArrayRingIterator;
+
+  template < typename T , class R = KeepAll >
+  class ArrayRingIterator;
+
+  //----------------------------------
+  //     ArrayRing<T,R>
+  //----------------------------------
+
+  template < typename T , class R >
+  class ArrayRing
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ArrayRingIterator < T , R >            Iterator;
+    typedef ConstArrayRingIterator < T , R >       ConstIterator;
+    typedef R                                      RetentionType;
+
+    // constructors and assignment
+                   ArrayRing  ();                   // default constructor
+                   ArrayRing  (T fill);             // development constructor
+    virtual        ~ArrayRing ();                   // destructor
+                   ArrayRing  (const ArrayRing& );  // copy constructor
+                   ArrayRing  (ArrayRing&& );       // move constructor; argument left empty
+    ArrayRing&     operator = (const ArrayRing& );  // assignment
+    ArrayRing&     operator = (ArrayRing&& );       // move assignment; exchanges arrays
+    virtual ArrayRing * Clone () const;             // returns ptr to deep copy of this list
+
+    // modifying List structure - mutators [1]
+    bool      PushFront  (const T& t);   // Insert t at front of list
+    bool      PushBack   (const T& t);   // Insert t at back of list
+    Iterator  Insert     (Iterator i, const T& t);  // Insert t at i
+    ConstIterator  Insert     (ConstIterator i, const T& t);  // ConstIterator version
+    Iterator  Insert     (const T& t);   // Insert t at back
+    ArrayRing& operator+= (const ArrayRing& list); // append list
+    bool      PushFront  (T&& t);
+    bool      PushBack   (T&& t);
+
+    bool      PopFront  ();              // Remove the Tval at front
+    bool      PopBack   ();              // Remove the Tval at back
+    Iterator  Remove    (Iterator i);    // Remove item at i
+    ConstIterator  Remove    (ConstIterator i);    // ConstIterator version
+    size_t    Remove    (const T& t);    // Remove all copies of t
+    void      Clear     ();              // make list empty; the array is kept
+    void      Release   ();              // de-allocate all slots except head and tail
+    bool      Reserve   (size_t n);      // at least n unused slots; false if out of memory
+    size_t    ShrinkToFit (size_t keep = 0); // halve the array while keep unused slots remain; returns slots freed
+    R&        Retention ();              // the retention policy of this list, for tuning and counts
+    const R&  Retention () const;
+
+    // macroscopic (whole list) mutators
+    void      Sort      ();               // default order <
+    void      Merge     (ArrayRing& list);  // merges "list" into this list
+    void      Reverse   ();
+    void      Shuffle   ();               // fixed permutation, that of alt2c::List
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Sort      (Predicate& p);
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Merge     (ArrayRing& list, Predicate& p);
+
+    // information about the list - accessors
+    size_t    Size     () const;  // return the number of elements on the list
+    size_t    Excess   () const;  // return the number of unused slots
+    size_t    Capacity () const;  // return the number of usable slots
+    bool      Empty    () const;
+    bool      Full     () const;
+
+    // memory held by the array, unused slots included
+    fsu::ListStats Stats       () const;
+    size_t         MemoryUsage () const;  // Stats().Bytes()
+
+    // accessing values on the list - more accessors
+    T&        Front ();        // return reference to Tval at front of list
+    const T&  Front () const;  // const version
+    T&        Back  ();        // return reference to Tval at back of list
+    const T&  Back  () const;  // const version
+
+    // generic display methods
+    void Display (std::ostream& os, char ofc = '\0') const;
+    void Dump    (std::ostream& os, char ofc = '\0') const;  // every slot, from the first element
+
+    // structural integrity check
+    void CheckLinks(std::ostream& os = std::cout) const;
+    void CheckIters(std::ostream& os = std::cout) const;
+
+    // Iterator support - locating places on the list
+    Iterator  Begin      (); // return iterator to front
+    Iterator  End        (); // return iterator "1 past the back"
+    Iterator  rBegin     (); // return iterator to back
+    Iterator  rEnd       (); // return iterator "1 past the front" in reverse
+    Iterator  Includes   (const T& t); // returns position of first occurrence of t, or End()
+
+    // ConstIterator support
+    ConstIterator  Begin      () const;
+    ConstIterator  End        () const;
+    ConstIterator  rBegin     () const;
+    ConstIterator  rEnd       () const;
+    ConstIterator  Includes   (const T& t) const;
+
+  protected:
+    T *     data_;  // the array; every slot holds a T
+    size_t  mask_,  // array size - 1, the size being a power of 2
+            head_,  // slot one before the first element
+            size_;  // number of elements, in the slots after head_
+    R       retain_; // retention policy for the unused slots
+
+    // positions: element k is in slot Slot(k); Slot(-1) is head_, Slot(size_) the tail
+    size_t Slot  (size_t k) const    { return (head_ + 1 + k) & mask_; }
+    size_t Index (size_t slot) const { return (slot - head_ - 1) & mask_; }
+    T&     At    (size_t k) const    { return data_[Slot(k)]; }
+
+    // protected methods -- used only by other methods
+    void Init   ();                        // an array of 2 slots, head and tail
+    void Append (const ArrayRing& list);   // append deep copy of list
+    bool Resize (size_t slots);            // move the elements to a new array of slots slots
+    bool Grow   ();                        // double the array of a Full() list
+    void Retain ();                        // halves the array as retain_ allows, after a removal
+
+    // shifts of the shorter side; element k is then at Slot(k)
+    bool    InsertAt (size_t k, T&& t);  // t becomes element k, k <= size_; false if out of memory
+    void    EraseAt  (size_t k);         // element k is removed, k < size_
+
+    // tight couplings
+    friend class ArrayRingIterator<T,R>;
+    friend class ConstArrayRingIterator<T,R>;
+  } ;
+
+  // global scope operators and functions
+
+  template < typename T , class R >
+  bool operator == (const ArrayRing<T,R>& list1, const ArrayRing<T,R>& list2);
+
+  template < typename T , class R >
+  bool operator != (const ArrayRing<T,R>& list1, const ArrayRing<T,R>& list2);
+
+  template < typename T , class R >
+  std::ostream& operator << (std::ostream& os, const ArrayRing<T,R>& list);
+
+  //----------------------------------
+  //     ConstArrayRingIterator<T,R>
+  //----------------------------------
+
+  template < typename T , class R >
+  class ConstArrayRingIterator
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstArrayRingIterator < T , R >       ConstIterator;
+    typedef ArrayRingIterator < T , R >            Iterator;
+
+    // constructors
+    ConstArrayRingIterator       ();                               // default constructor
+    ConstArrayRingIterator       (const ConstArrayRingIterator& ); // copy constructor
+
+    // information/access
+    bool Valid         () const;  // cursor is at an element, the head or the tail [3]
+
+    // various operators
+    bool            operator == (const ConstIterator& i2) const;
+    bool            operator != (const ConstIterator& i2) const;
+    const T&        operator *  () const; // Return const reference to current Tval
+    ConstIterator&  operator =  (const ConstIterator& i);
+    ConstIterator&  operator ++ ();    // prefix
+    ConstIterator   operator ++ (int); // postfix
+    ConstIterator&  operator -- ();    // prefix
+    ConstIterator   operator -- (int); // postfix
+
+  protected:
+    // data: slot slot_ of the array of ring_
+    const ArrayRing<T,R> * ring_;
+    size_t                 slot_;
+
+    // methods
+    ConstArrayRingIterator (const ArrayRing<T,R> * ring, size_t slot); // type converting constructor
+    T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
+
+    // tight couplings
+    friend class ArrayRing<T,R>;
+  } ;
+
+  //----------------------------------
+  //     ArrayRingIterator<T,R>
+  //----------------------------------
+
+  template < typename T , class R >
+  class ArrayRingIterator : public ConstArrayRingIterator<T,R>
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstArrayRingIterator < T , R >       ConstIterator;
+    typedef ArrayRingIterator < T , R >            Iterator;
+
+    // constructors
+    ArrayRingIterator       ();                            // default constructor
+    ArrayRingIterator       (ArrayRing<T,R>& );            // initializing constructor
+    ArrayRingIterator       (const ArrayRingIterator& );   // copy constructor
+
+    // various operators
+    T&         operator *  ();       // Return reference to current Tval
+    const T&   operator *  () const; // const version
+    Iterator&  operator =  (const Iterator& i);
+    Iterator&  operator ++ ();    // prefix
+    Iterator   operator ++ (int); // postfix
+    Iterator&  operator -- ();    // prefix
+    Iterator   operator -- (int); // postfix
+
+  protected:
+    // methods
+    ArrayRingIterator (const ArrayRing<T,R> * ring, size_t slot); // type converting constructor
+
+    // tight couplings
+    friend class ArrayRing<T,R>;
+  } ;
+
+#include <aring.cpp>
+#include <aring_macro.cpp>
+
+} // namespace alt2c
+
+/* Notes
+   =====
+
+[1] Positions are slots of the array, so, unlike alt2c::List, mutators may
+    make iterators to other elements of the same list illegitimate:
+
+      Push                         - all iterators, when the array grows
+      Insert, Remove(i)            - iterators on the shifted side, or all
+                                     when the array grows or shrinks
+      Pop                          - all iterators, when the array shrinks
+      Remove(t), Sort, Merge,
+      Shuffle, Reverse             - all iterators of the list
+
+    The returned iterator of Insert and Remove(i) is always legitimate.
+    Under KeepAll the array never shrinks, so pops leave the iterators to
+    the other elements alone. An iterator left on a slot that is no longer
+    at an element, the head or the tail is not Valid(), so it cannot reach
+    outside the array.
+
+[2] Shrinking moves every element to a new array, so it happens only when
+    the policy asks for a trim and the array can at least be halved. As in
+    alt2c::List, unused slots keep the values they last held, and *End()
+    and *rEnd() are defined; Stats() counts a slot as a link of sizeof(T)
+    bytes and reports the payload of the whole array, retainedBytes being
+    the part outside the elements.
+
+[3] Valid() is true at the elements, at End() and at rEnd(). An iterator
+    incremented past End() moves onto the unused slots, where Valid() is
+    false, and reaches rEnd() when the list is Full().
+*/
+
+#endif
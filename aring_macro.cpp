@@ -0,0 +1,153 @@
+/*
+    aring_macro.cpp
+    Andrew J Wood
+
+    slave file to aring.h
+
+    Implementation of ArrayRing<T,R>:: macroscopic (whole list) mutators
+    Sort, Merge, Reverse, Shuffle
+
+    Each works on the elements in their slots, or on a scratch array, and
+    leaves every slot outside the elements as it found it.
+*/
+
+//----------------------------------
+//     ArrayRing<T,R>::Sort Implementations
+//----------------------------------
+
+template < typename T , class R >
+template < class P >
+void ArrayRing<T,R>::Sort (P& comp)
+// bottom-up merge sort through two scratch arrays; stable, as the link sorts are
+{
+  if (size_ < 2)
+    return;
+  T * a = new(std::nothrow) T [size_];
+  T * b = new(std::nothrow) T [size_];
+  if (a == nullptr || b == nullptr)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    delete [] a;
+    delete [] b;
+    return;
+  }
+  for (size_t k = 0; k < size_; ++k)
+    a[k] = std::move(At(k));
+  for (size_t width = 1; width < size_; width *= 2)
+  {
+    for (size_t lo = 0; lo < size_; lo += 2 * width)
+    {
+      size_t mid = lo + width < size_ ? lo + width : size_;
+      size_t hi  = mid + width < size_ ? mid + width : size_;
+      size_t i = lo, j = mid, k = lo;
+      while (i < mid && j < hi)
+      {
+        if (comp(a[j],a[i])) // strictly before: ties keep their order
+          b[k++] = std::move(a[j++]);
+        else
+          b[k++] = std::move(a[i++]);
+      }
+      while (i < mid)
+        b[k++] = std::move(a[i++]);
+      while (j < hi)
+        b[k++] = std::move(a[j++]);
+    }
+    std::swap(a,b);
+  }
+  for (size_t k = 0; k < size_; ++k)
+    At(k) = std::move(a[k]);
+  delete [] a;
+  delete [] b;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
+//-----------------------------------
+//     ArrayRing<T,R>::Merge Implementations
+//-----------------------------------
+
+template < typename T , class R >
+template < class P >
+void ArrayRing<T,R>::Merge (ArrayRing<T,R>& y, P& p)
+// merges y into this list; post: true = y.Empty(), y keeps its array
+// if both lists are ordered result is ordered
+{
+  if (this == &y || y.size_ == 0)
+    return;
+  if (!Reserve(y.size_))
+    return;
+  // the list starts y.size_ unused slots earlier, so the merge can run forward,
+  // writing ahead of the elements of x still to be read
+  size_t n = size_, m = y.size_;
+  size_t first = Slot(0);
+  head_ = (head_ - m) & mask_;
+  size_t i = 0, j = 0, k = 0;
+  while (i < n && j < m)
+  {
+    if (p(y.At(j),data_[(first + i) & mask_])) // y < x
+      At(k++) = std::move(y.At(j++));
+    else                                       // x <= y
+      At(k++) = std::move(data_[(first + i++) & mask_]);
+  }
+  while (j < m)
+    At(k++) = std::move(y.At(j++));
+  // the rest of x is already in place
+  size_ = n + m;
+  y.size_ = 0;
+}
+
+template < typename T , class R >
+void ArrayRing<T,R>::Merge (ArrayRing<T,R>& y)
+{
+  fsu::LessThan<T> p;
+  Merge(y,p);
+}
+
+//------------------------------------
+//     ArrayRing<T,R>::Reverse Implementation
+//------------------------------------
+
+template < typename T , class R >
+void ArrayRing<T,R>::Reverse ()
+{
+  for (size_t k = 0; k < size_ / 2; ++k)
+    std::swap(At(k),At(size_ - 1 - k));
+}
+
+//------------------------------------
+//     ArrayRing<T,R>::Shuffle Implementation
+//------------------------------------
+
+template < typename T , class R >
+void ArrayRing<T,R>::Shuffle ()
+// the permutation of alt2c::List::Shuffle(): positions 0,3,6,.. in reverse,
+// then 1,4,7,.. in reverse, then 2,5,8,.. in order
+{
+  if (size_ < 2)
+    return;
+  T * a = new(std::nothrow) T [size_];
+  if (a == nullptr)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    return;
+  }
+  size_t n = 0;
+  for (size_t r = 0; r < 2; ++r)
+  {
+    for (size_t k = size_; k-- > 0; )
+      if (k % 3 == r)
+        a[n++] = std::move(At(k));
+  }
+  for (size_t k = 2; k < size_; k += 3)
+    a[n++] = std::move(At(k));
+  for (size_t k = 0; k < size_; ++k)
+    At(k) = std::move(a[k]);
+  delete [] a;
+}
+
+// end macromutators */
@@ -0,0 +1,410 @@
+/*
+    clist.cpp
+    Andrew J Wood
+
+    slave file to clist.h
+
+    Implementation of fsu::EpochDomain and fsu::ConcurrentList<T,P>
+
+    The EpochDomain members are not templates; they are declared inline so
+    that the header may be included in several translation units.
+*/
+
+//----------------------------------
+//     EpochDomain Implementation
+//----------------------------------
+
+inline EpochDomain& EpochDomain::Global ()
+{
+  static EpochDomain domain;
+  return domain;
+}
+
+inline EpochDomain::EpochDomain () : epoch_(0), high_(0)
+{
+  for (size_t i = 0; i < CLIST_MAX_THREADS; ++i)
+  {
+    Slot& s = slot_[i];
+    s.state.store(0);
+    s.owned.store(0);
+    s.depth = 0;
+    s.retires = 0;
+    for (size_t j = 0; j < 3; ++j)
+    {
+      s.bag[j].item = nullptr;
+      s.bag[j].size = s.bag[j].capacity = 0;
+      s.bag[j].epoch = j;
+    }
+  }
+}
+
+inline EpochDomain::~EpochDomain ()
+// no thread is left to read a retired link
+{
+  for (size_t i = 0; i < CLIST_MAX_THREADS; ++i)
+    for (size_t j = 0; j < 3; ++j)
+    {
+      slot_[i].bag[j].Free();
+      delete [] slot_[i].bag[j].item;
+    }
+}
+
+inline bool EpochDomain::Bag::Push (const Retired& r)
+{
+  if (size == capacity)
+  {
+    size_t newCapacity = capacity ? 2 * capacity : CLIST_RETIRE_BATCH;
+    Retired * newItem = new(std::nothrow) Retired [newCapacity];
+    if (newItem == nullptr) return 0;
+    for (size_t k = 0; k < size; ++k)
+      newItem[k] = item[k];
+    delete [] item;
+    item = newItem;
+    capacity = newCapacity;
+  }
+  item[size++] = r;
+  return 1;
+}
+
+inline void EpochDomain::Bag::Free ()
+{
+  for (size_t k = 0; k < size; ++k)
+    item[k].destroy(item[k].p);
+  size = 0;
+}
+
+inline EpochDomain::Owner::~Owner ()
+// the thread is ending: its bags stay with the slot for the next owner
+{
+  EpochDomain& d = EpochDomain::Global();
+  d.slot_[slot].state.store(0);
+  d.slot_[slot].owned.store(0,std::memory_order_release);
+}
+
+inline EpochDomain::Slot& EpochDomain::Local ()
+{
+  static thread_local Owner owner { Global().Claim() };
+  return slot_[owner.slot];
+}
+
+inline size_t EpochDomain::Claim ()
+// first free slot; waits while all CLIST_MAX_THREADS are held [2]
+{
+  for (;;)
+  {
+    for (size_t i = 0; i < CLIST_MAX_THREADS; ++i)
+    {
+      bool expected = 0;
+      if (!slot_[i].owned.load(std::memory_order_relaxed)
+          && slot_[i].owned.compare_exchange_strong(expected,1,std::memory_order_acquire))
+      {
+        size_t high = high_.load();
+        while (high < i + 1 && !high_.compare_exchange_weak(high,i + 1)) {}
+        return i;
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+inline void EpochDomain::Enter ()
+{
+  Slot& s = Local();
+  if (s.depth++ > 0) return;
+  uint64_t e = epoch_.load();
+  for (;;) // announce e, then make sure the epoch did not move on meanwhile
+  {
+    s.state.exchange(2 * e + 1);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // announced before any link is read
+    uint64_t f = epoch_.load();
+    if (f == e) break;
+    e = f;
+  }
+}
+
+inline void EpochDomain::Exit ()
+{
+  Slot& s = Local();
+  if (--s.depth == 0)
+    s.state.store(0,std::memory_order_release);
+}
+
+inline void EpochDomain::Retire (void * p, void (*destroy) (void*))
+{
+  Slot& s = Local();
+  std::atomic_thread_fence(std::memory_order_seq_cst); // p was unlinked before the epoch is read
+  uint64_t e = epoch_.load();
+  Bag& b = s.bag[e % 3];
+  if (b.epoch != e) // the bag holds epoch e - 3 or older, out of reach since e - 1
+  {
+    b.Free();
+    b.epoch = e;
+  }
+  if (!b.Push(Retired { p , destroy }))
+    std::cerr << "** EpochDomain error: memory allocation failure, a link is not reclaimed\n";
+  if (++s.retires >= CLIST_RETIRE_BATCH)
+  {
+    s.retires = 0;
+    Advance();
+    Reclaim(s);
+  }
+}
+
+inline bool EpochDomain::Advance ()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t e = epoch_.load();
+  size_t high = high_.load();
+  for (size_t i = 0; i < high; ++i)
+  {
+    uint64_t state = slot_[i].state.load();
+    if ((state & 1) && (state >> 1) != e)
+      return 0;
+  }
+  return epoch_.compare_exchange_strong(e,e + 1);
+}
+
+inline void EpochDomain::Reclaim (Slot& s)
+{
+  uint64_t e = epoch_.load();
+  for (size_t j = 0; j < 3; ++j)
+    if (s.bag[j].epoch + 2 <= e)
+      s.bag[j].Free();
+}
+
+//----------------------------------
+//     ConcurrentList<T,P> Implementation
+//----------------------------------
+
+template < typename T , class P >
+ConcurrentList<T,P>::ConcurrentList () : head_(0), size_(0), pred_()
+{}
+
+template < typename T , class P >
+ConcurrentList<T,P>::ConcurrentList (const P& p) : head_(0), size_(0), pred_(p)
+{}
+
+template < typename T , class P >
+ConcurrentList<T,P>::~ConcurrentList ()
+// deletes every node still linked, marked or not; unlinked nodes belong to the domain
+{
+  Node * curr = Ptr(head_.load());
+  while (curr != nullptr)
+  {
+    Node * next = Ptr(curr->next_.load());
+    delete curr;
+    curr = next;
+  }
+}
+
+template < typename T , class P >
+template < class S >
+void ConcurrentList<T,P>::Search (S stop, std::atomic<uintptr_t> *& prev, Node *& curr) const
+// the caller holds a Guard
+{
+  bool retry = 1;
+  while (retry)
+  {
+    retry = 0;
+    prev = &head_;
+    curr = Ptr(prev->load(std::memory_order_acquire));
+    while (curr != nullptr)
+    {
+      uintptr_t succ = curr->next_.load(std::memory_order_acquire);
+      if (Marked(succ)) // curr is being removed: swing prev past it
+      {
+        uintptr_t expected = Word(curr);
+        if (!prev->compare_exchange_strong(expected,succ & ~uintptr_t(1),std::memory_order_acq_rel))
+        {
+          retry = 1; // prev changed or was itself marked
+          break;
+        }
+        EpochDomain::Global().Retire(curr,&Destroy);
+        curr = Ptr(succ);
+        continue;
+      }
+      if (stop(curr))
+        return;
+      prev = &curr->next_;
+      curr = Ptr(succ);
+    }
+  }
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::Unlink (std::atomic<uintptr_t> * prev, Node * curr) const
+// the thread that marks curr removes it; whoever unlinks it retires it
+{
+  uintptr_t succ = curr->next_.load(std::memory_order_acquire);
+  if (Marked(succ))
+    return 0;
+  if (!curr->next_.compare_exchange_strong(succ,succ | 1,std::memory_order_acq_rel))
+    return 0;
+  size_.fetch_sub(1,std::memory_order_relaxed);
+  uintptr_t expected = Word(curr);
+  if (prev->compare_exchange_strong(expected,succ,std::memory_order_acq_rel))
+    EpochDomain::Global().Retire(curr,&Destroy);
+  // otherwise a later Search unlinks and retires it
+  return 1;
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::Insert (const T& t)
+{
+  Node * node = new(std::nothrow) Node(t);
+  if (node == nullptr)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    return 0;
+  }
+  size_.fetch_add(1,std::memory_order_relaxed); // before the node can be removed [3]
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  auto after = [this,&t] (Node * n) { return pred_(t,n->Tval_); };
+  for (;;)
+  {
+    Search(after,prev,curr);
+    node->next_.store(Word(curr),std::memory_order_relaxed);
+    uintptr_t expected = Word(curr);
+    if (prev->compare_exchange_strong(expected,Word(node),std::memory_order_acq_rel))
+      return 1;
+  }
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::PopFront ()
+{
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  auto first = [] (Node * ) { return 1; };
+  for (;;)
+  {
+    Search(first,prev,curr);
+    if (curr == nullptr)
+      return 0;
+    if (Unlink(prev,curr))
+      return 1;
+  }
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::PopFront (T& t)
+{
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  auto first = [] (Node * ) { return 1; };
+  for (;;)
+  {
+    Search(first,prev,curr);
+    if (curr == nullptr)
+      return 0;
+    if (Unlink(prev,curr))
+    {
+      t = curr->Tval_; // still readable: the guard holds off its deletion
+      return 1;
+    }
+  }
+}
+
+template < typename T , class P >
+size_t ConcurrentList<T,P>::Remove (const T& t)
+{
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  auto notBefore = [this,&t] (Node * n) { return !pred_(n->Tval_,t); };
+  size_t count = 0;
+  for (;;)
+  {
+    Search(notBefore,prev,curr);
+    if (curr == nullptr || pred_(t,curr->Tval_))
+      return count;
+    if (Unlink(prev,curr))
+      ++count;
+  }
+}
+
+template < typename T , class P >
+void ConcurrentList<T,P>::Clear ()
+{
+  while (PopFront()) {}
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::Includes (const T& t) const
+{
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  auto notBefore = [this,&t] (Node * n) { return !pred_(n->Tval_,t); };
+  Search(notBefore,prev,curr);
+  return curr != nullptr && !pred_(t,curr->Tval_);
+}
+
+template < typename T , class P >
+size_t ConcurrentList<T,P>::Size () const
+{
+  return size_.load(std::memory_order_relaxed);
+}
+
+template < typename T , class P >
+bool ConcurrentList<T,P>::Empty () const
+{
+  Guard guard;
+  std::atomic<uintptr_t> * prev;
+  Node * curr;
+  Search([] (Node * ) { return 1; },prev,curr);
+  return curr == nullptr;
+}
+
+template < typename T , class P >
+void ConcurrentList<T,P>::Display (std::ostream& os, char ofc) const
+{
+  Guard guard;
+  for (Node * curr = Ptr(head_.load(std::memory_order_acquire)); curr != nullptr; )
+  {
+    uintptr_t succ = curr->next_.load(std::memory_order_acquire);
+    if (!Marked(succ))
+    {
+      if (ofc != '\0')
+        os << ofc;
+      os << curr->Tval_;
+    }
+    curr = Ptr(succ);
+  }
+} // Display()
+
+template < typename T , class P >
+void ConcurrentList<T,P>::Dump (std::ostream& os, char ofc) const
+{
+  Display(os,ofc);
+  os << '\n';
+} // Dump()
+
+template < typename T , class P >
+void ConcurrentList<T,P>::CheckLinks (std::ostream& os) const
+{
+  size_t n = 0;
+  Node * last = nullptr;
+  for (Node * curr = Ptr(head_.load()); curr != nullptr; curr = Ptr(curr->next_.load()))
+  {
+    if (Marked(curr->next_.load()))
+      continue; // removed, not yet unlinked
+    if (last != nullptr && pred_(curr->Tval_,last->Tval_))
+      os << " ** order failure at position " << n << '\n';
+    last = curr;
+    ++n;
+  }
+  if (n != Size())
+    os << " ** Size() mismatch: count = " << n << " , size = " << Size() << '\n';
+} // CheckLinks()
+
+template < typename T , class P >
+std::ostream& operator << (std::ostream& os, const ConcurrentList<T,P>& x)
+{
+  x.Display(os);
+  return os;
+}
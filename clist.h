@@ -0,0 +1,225 @@
+/*
+    clist.h
+    Andrew J Wood
+
+    Definition of the fsu::ConcurrentList<T,P> API
+
+    An ordered singly linked list that many threads may use at once without
+    locks: the lock-free list of Harris, in the form given by Michael. Each
+    link's next pointer carries a mark bit; Remove first marks the link
+    (logical deletion) and then swings its predecessor past it (physical
+    deletion), and any thread that meets a marked link on its way finishes
+    the job. Insert, Remove, PopFront and Includes never block one another.
+
+    The elements are kept in the order of the predicate P (default <), so
+    the interface is the part of fsu::List<T> (list.h) that makes sense for
+    a shared ordered set of values: there are no positions to push at, and
+    no iterators, since another thread may remove the element an iterator
+    refers to at any time [1]. Elements are equal when neither precedes the
+    other under P.
+
+      fsu::ConcurrentList < long > work;   // shared by the worker threads
+      work.Insert(17);                     // any thread
+      long job;
+      if (work.PopFront(job)) ...          // the least element, or false
+
+    Removed links are reclaimed through an EpochDomain: a link is deleted
+    only once every thread that was inside a list operation when it was
+    unlinked has left that operation [2].
+
+    cmlist.cpp drives the list from 1 to N threads and reports the rate of
+    operations at each thread count.
+*/
+
+#ifndef _CLIST_H
+#define _CLIST_H
+
+#include <iostream>    // class ostream and objects cerr, cout
+#include <cstdlib>     // size_t
+#include <cstdint>     // uint64_t, uintptr_t
+#include <new>         // std::nothrow
+#include <atomic>      // std::atomic
+#include <thread>      // std::this_thread::yield
+#include <compare.h>   // default order LessThan<T>
+
+#ifndef CLIST_MAX_THREADS
+#define CLIST_MAX_THREADS 256  // threads that may be inside list operations at once [2]
+#endif
+
+#ifndef CLIST_RETIRE_BATCH
+#define CLIST_RETIRE_BATCH 64  // retirements between attempts to advance the epoch [2]
+#endif
+
+namespace fsu
+{
+
+  //----------------------------------
+  //     EpochDomain
+  //----------------------------------
+
+  class EpochDomain
+  {
+  public:
+    static EpochDomain& Global (); // the domain of all concurrent lists
+
+    void Enter  ();  // the calling thread starts reading shared links; may nest
+    void Exit   ();  // and stops
+    void Retire (void * p, void (*destroy) (void*)); // destroy(p) once no reader can hold p
+
+    ~EpochDomain ();
+
+  private:
+    struct Retired
+    {
+      void * p;
+      void (*destroy) (void*);
+    } ;
+
+    struct Bag // links retired in one epoch, by one slot
+    {
+      Retired * item;
+      size_t    size, capacity;
+      uint64_t  epoch;
+      bool Push (const Retired& r);
+      void Free ();   // destroys the items and empties the bag
+    } ;
+
+    struct alignas(64) Slot // one per thread inside the domain, on its own cache line
+    {
+      std::atomic<uint64_t> state;   // 0 outside, 2 * epoch + 1 inside
+      std::atomic<bool>     owned;   // claimed by a live thread
+      size_t                depth;   // nesting of Enter
+      size_t                retires; // since the last attempt to advance
+      Bag                   bag[3];  // by epoch % 3
+    } ;
+
+    struct Owner // thread_local: gives the slot back when the thread ends
+    {
+      size_t slot;
+      ~Owner ();
+    } ;
+
+    EpochDomain ();
+    EpochDomain (const EpochDomain&) = delete;
+    EpochDomain& operator = (const EpochDomain&) = delete;
+
+    Slot&  Local    ();  // the calling thread's slot, claimed on first use
+    size_t Claim    ();
+    bool   Advance  ();  // true iff the epoch moved on
+    void   Reclaim  (Slot& s); // frees the bags of s that no reader can reach
+
+    std::atomic<uint64_t> epoch_;
+    std::atomic<size_t>   high_;  // slots [0,high_) have been claimed at some time
+    Slot                  slot_[CLIST_MAX_THREADS];
+  } ;
+
+  //----------------------------------
+  //     ConcurrentList<T,P>
+  //----------------------------------
+
+  template < typename T , class P = fsu::LessThan<T> >
+  class ConcurrentList
+  {
+  public:
+    // terminology support
+    typedef T  ValueType;
+    typedef P  PredicateType;
+
+    // constructors and destructor; the list itself is not copied or moved
+             ConcurrentList  ();
+    explicit ConcurrentList  (const P& p);
+             ~ConcurrentList ();   // no other thread may be using the list
+    ConcurrentList (const ConcurrentList& ) = delete;
+    ConcurrentList& operator = (const ConcurrentList& ) = delete;
+
+    // modifying the list - safe from any number of threads
+    bool      Insert    (const T& t);   // t after the elements equal to t; false if out of memory
+    bool      PopFront  ();             // remove the first element; false if empty
+    bool      PopFront  (T& t);         // the same, copying the element to t
+    size_t    Remove    (const T& t);   // remove all elements equal to t; returns the number removed
+    void      Clear     ();             // remove elements until the list is empty
+
+    // information about the list - safe from any number of threads
+    bool      Includes  (const T& t) const; // true iff an element equal to t is on the list
+    size_t    Size      () const;  // number of elements; exact when no thread is modifying [3]
+    bool      Empty     () const;  // true iff list has no elements
+
+    // generic display methods; the elements on the list as it is traversed
+    void Display (std::ostream& os, char ofc = '\0') const;
+    void Dump    (std::ostream& os, char ofc = '\0') const;
+
+    // structural integrity check; only while no thread is modifying the list
+    void CheckLinks (std::ostream& os = std::cout) const;
+
+  private:
+    class Node
+    {
+      friend class ConcurrentList<T,P>;
+      T                      Tval_;
+      std::atomic<uintptr_t> next_;  // successor, with the mark bit of this node
+      Node (const T& t) : Tval_(t), next_(0) {}
+    } ;
+
+    class Guard // the calling thread is inside a list operation while a Guard lives
+    {
+    public:
+      Guard  () { EpochDomain::Global().Enter(); }
+      ~Guard () { EpochDomain::Global().Exit(); }
+    } ;
+
+    static Node *   Ptr     (uintptr_t w) { return reinterpret_cast<Node*>(w & ~uintptr_t(1)); }
+    static bool     Marked  (uintptr_t w) { return (w & 1) != 0; }
+    static uintptr_t Word   (Node * n)    { return reinterpret_cast<uintptr_t>(n); }
+    static void     Destroy (void * p)    { delete static_cast<Node*>(p); }
+
+    // finds prev, the link word pointing to curr, where curr is the first
+    // unmarked node for which stop(curr) is true, or nullptr; marked nodes
+    // on the way are unlinked and retired
+    template < class S >
+    void     Search  (S stop, std::atomic<uintptr_t> *& prev, Node *& curr) const;
+
+    // marks curr, found at prev, and unlinks it; false if another thread got there first
+    bool     Unlink  (std::atomic<uintptr_t> * prev, Node * curr) const;
+
+    mutable std::atomic<uintptr_t> head_;  // first node, never marked
+    mutable std::atomic<size_t>    size_;  // [3]
+    P                              pred_;  // order of the elements
+  } ;
+
+  template < typename T , class P >
+  std::ostream& operator << (std::ostream& os, const ConcurrentList<T,P>& x);
+
+#include <clist.cpp>
+
+} // namespace fsu
+
+/* Notes
+   =====
+
+[1] A list.h iterator stays valid until its element is removed, which a
+    single thread controls; here any thread may remove any element, so
+    the list hands out copies (PopFront(t)) and answers (Includes)
+    instead. Display traverses the list inside one operation and shows
+    the elements present as it passes them.
+
+[2] Epoch-based reclamation. A thread inside an operation announces the
+    global epoch it saw in its Slot. A link is retired, with the epoch
+    current when it was unlinked, to a bag of the retiring thread's slot.
+    Every CLIST_RETIRE_BATCH retirements the thread tries to advance the
+    epoch, which succeeds when every announcing thread has seen the
+    current one. A link retired in epoch e is deleted once the epoch
+    reaches e + 2: by then every thread that could have read it has left
+    its operation. A thread that stalls inside an operation therefore
+    holds back reclamation, though not progress, of all the others.
+    Slots are claimed on a thread's first operation and given back, with
+    any links still in their bags, when the thread ends; at most
+    CLIST_MAX_THREADS threads hold slots at once, and a further thread
+    waits for one. Links still in bags at program end are deleted with
+    the domain.
+
+[3] size_ is counted up before a node is linked and down when a node is
+    marked, so Size() never runs below the number of elements and is
+    exact whenever no Insert or removal is under way.
+*/
+
+#endif
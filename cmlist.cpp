@@ -0,0 +1,148 @@
+/*
+    cmlist.cpp
+    Andrew J Wood
+
+    Multithreaded random test of ConcurrentList<>
+
+    Driver program in the manner of mlist.cpp: a number of threads share
+    one ConcurrentList<T> and apply a random mix of Insert, Remove,
+    PopFront and Includes to it. The test is repeated with 1, 2, 4, ...
+    threads up to the maximum, on a fresh list each time, and reports the
+    rate of operations at each thread count and the speedup over one
+    thread. After each run the list is checked: it must be in order, and
+    its size must be the initial size plus the inserts less the removals
+    counted by the threads.
+
+    Usage: cmlist [max threads] [operations per thread] [key range]
+    defaults: hardware threads, 1000000, 1000
+
+    The list is ordered, so each operation walks half of it on average:
+    the key range sets the length of the list and with it the cost of an
+    operation against the contention between threads.
+
+    Compile with -pthread.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <clist.h>
+#include <xran.h>
+#include <xran.cpp>  // in lieu of makefile
+
+typedef long                                ElementType;
+typedef fsu::ConcurrentList < ElementType > ContainerType;
+
+// operation mix, in percent of operations; the rest are Includes
+const unsigned int insertPercent  = 20;
+const unsigned int removePercent  = 15;
+const unsigned int popPercent     =  5;
+
+struct Counts
+{
+  unsigned long inserts, removals;
+} ;
+
+void Worker (ContainerType& x, unsigned long ops, unsigned long range, uint64_t seed, Counts& counts)
+// one thread of the test: ops random operations on keys in [0,range)
+{
+  fsu::RandomBase ran(seed);
+  unsigned long inserts = 0, removals = 0;
+  for (unsigned long k = 0; k < ops; ++k)
+  {
+    ElementType t = static_cast<ElementType>(ran.Below(range));
+    unsigned int option = static_cast<unsigned int>(ran.Below(100));
+    if (option < insertPercent)
+    {
+      if (x.Insert(t)) ++inserts;
+    }
+    else if (option < insertPercent + removePercent)
+    {
+      removals += x.Remove(t);
+    }
+    else if (option < insertPercent + removePercent + popPercent)
+    {
+      if (x.PopFront()) ++removals;
+    }
+    else
+    {
+      x.Includes(t);
+    }
+  }
+  counts.inserts = inserts;
+  counts.removals = removals;
+}
+
+double Run (size_t threads, unsigned long ops, unsigned long range, bool& ok)
+// returns operations per second over all threads
+{
+  ContainerType x;
+  fsu::RandomBase ran(12345);
+  size_t initial = range / 2;
+  for (size_t k = 0; k < initial; ++k)
+    x.Insert(static_cast<ElementType>(ran.Below(range)));
+
+  std::thread * worker = new std::thread [threads];
+  Counts * counts = new Counts [threads];
+  auto start = std::chrono::steady_clock::now();
+  for (size_t j = 0; j < threads; ++j)
+    worker[j] = std::thread(Worker,std::ref(x),ops,range,uint64_t(1000 + j),std::ref(counts[j]));
+  for (size_t j = 0; j < threads; ++j)
+    worker[j].join();
+  auto stop = std::chrono::steady_clock::now();
+
+  size_t expected = initial;
+  for (size_t j = 0; j < threads; ++j)
+    expected += counts[j].inserts - counts[j].removals;
+  std::ostringstream check;  // CheckLinks reports failures only, so any output is one
+  x.CheckLinks(check);
+  if (!check.str().empty())
+  {
+    std::cout << check.str();
+    ok = 0;
+  }
+  if (x.Size() != expected)
+  {
+    std::cout << " ** size " << x.Size() << " , expected " << expected << '\n';
+    ok = 0;
+  }
+  delete [] worker;
+  delete [] counts;
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  return seconds > 0 ? threads * ops / seconds : 0;
+}
+
+int main(int argc, char* argv[])
+{
+  size_t maxThreads = argc > 1 ? atoi(argv[1]) : std::thread::hardware_concurrency();
+  unsigned long ops = argc > 2 ? atol(argv[2]) : 1000000;
+  unsigned long range = argc > 3 ? atol(argv[3]) : 1000;
+  if (maxThreads == 0) maxThreads = 1;
+  if (range == 0) range = 1;
+
+  std::cout << "\nStarting multithreaded random test of ConcurrentList < long >"
+            << "\n  " << ops << " operations per thread, keys in [0," << range << ")"
+            << "\n  mix: " << insertPercent << "% Insert, " << removePercent << "% Remove, "
+            << popPercent << "% PopFront, "
+            << 100 - insertPercent - removePercent - popPercent << "% Includes\n\n";
+  std::cout << std::setw(8) << "threads" << std::setw(16) << "ops/sec" << std::setw(10) << "speedup" << '\n';
+
+  bool ok = 1;
+  double base = 0;
+  size_t threads = 1;  // 1, 2, 4, ... and maxThreads
+  while (1)
+  {
+    double rate = Run(threads,ops,range,ok);
+    if (threads == 1) base = rate;
+    std::cout << std::setw(8) << threads << std::setw(16) << std::fixed << std::setprecision(0) << rate
+              << std::setw(10) << std::setprecision(2) << (base > 0 ? rate / base : 0) << '\n';
+    if (threads == maxThreads) break;
+    threads = threads * 2 < maxThreads ? threads * 2 : maxThreads;
+  }
+  std::cout << (ok ? "\nAll runs consistent\n" : "\n ** inconsistency found\n");
+  return ok ? 0 : 1;
+}
@@ -4,7 +4,8 @@
     Chris Lacher
 
     Defining and implementing the predicate classes
-    LessThan<T> and GreaterThan<T>
+    LessThan<T> and GreaterThan<T>, and the traits HasLess<T> and
+    OptionalLess<T> used by containers that track their order
 
     Copyright 2012, R.C. Lacher
 */
@@ -12,6 +13,8 @@
 #ifndef _COMPARE_H
 #define _COMPARE_H
 
+#include <utility> // std::declval
+
 namespace fsu
 {
 
@@ -60,5 +63,36 @@ template < typename T >
 bool operator != ( const GreaterThan<T>& , const GreaterThan<T>& )
 { return 0; }
 
+// HasLess<T>::value is true iff t1 < t2 compiles for const T& t1, t2;
+// OptionalLess<T>::Less is < for such T and false for any other, so that
+// a container can test its order without requiring operator < of T
+
+template < typename T >
+class HasLess
+{
+    template < typename U >
+    static auto Test (int) -> decltype(std::declval<const U&>() < std::declval<const U&>(), char());
+    template < typename U >
+    static long Test (...);
+  public:
+    static const bool value = sizeof(Test<T>(0)) == sizeof(char);
+} ;
+
+template < typename T , bool = HasLess<T>::value >
+class OptionalLess
+{
+  public:
+    static const bool able = 1;
+    static bool Less (const T& t1, const T& t2) { return (t1 < t2); }
+} ;
+
+template < typename T >
+class OptionalLess < T , false >
+{
+  public:
+    static const bool able = 0;
+    static bool Less (const T& , const T& ) { return 0; }
+} ;
+
 } // namespace fsu
 #endif
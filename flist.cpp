@@ -22,6 +22,8 @@
 #include <cctype>  // tolower()
 #include <cmath>   // log2() called in some versions of List
 #include <list.h>
+#include <ulist.h>
+#include <plist.h>
 #include <compare.h>
 #include <xstring.h>
 #include <xstring.cpp> // avoid separate build
@@ -50,9 +52,7 @@ const char code0 = 'c';
 const char code1 = '1';
 // end A2 */
 
-/* // A3: makes lists of String
-#include <xstring.h>
-#include <xstring.cpp> // in lieu of makefile
+/* // A3: makes lists of String (xstring.h and xstring.cpp are included above)
 typedef fsu::String  ElementType;
 const char ofc = ' ';
 const char* vT = "String";
@@ -69,6 +69,10 @@ const char code1 = '1';
 // end A4 */
 
 typedef fsu::List < ElementType >       ContainerType;
+// typedef fsu::UnrolledList < ElementType > ContainerType; // nodes of ULIST_BLOCK_SIZE elements
+// typedef fsu::List < ElementType , fsu::SkipIndex > ContainerType; // O(log n) positional access
+// typedef fsu::IndexedList < ElementType > ContainerType; // O(1) Includes, Remove(t); CheckLinks flags values changed by '^'
+// typedef fsu::PoolList < ElementType > ContainerType; // nodes in one array, 32-bit links
 typedef fsu::GreaterThan< ElementType > PredicateType;
 
 void Preamble(std::ostream& os = std::cout);
@@ -554,6 +558,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x1.Size() << " = x1.Size();\n";
 	    break;
 
+          case 'u': case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x1.Stats() << " = x1.Stats();\n";
+            *osptr << "  " << x1.MemoryUsage() << " = x1.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x1.Sort();
@@ -1105,6 +1115,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x2.Size() << " = x1.Size();\n";
 	    break;
 
+          case 'u': case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x2.Stats() << " = x2.Stats();\n";
+            *osptr << "  " << x2.MemoryUsage() << " = x2.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x2.Sort();
@@ -1656,6 +1672,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x3.Size() << " = x3.Size();\n";
 	    break;
 
+          case 'u': case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x3.Stats() << " = x3.Stats();\n";
+            *osptr << "  " << x3.MemoryUsage() << " = x3.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x3.Sort();
@@ -1952,7 +1974,7 @@ void DisplayMenu(std::ostream& os)
        << "  ++I  ...................  ++     --I  ...................  --\n"
        << "  Sort  ..................  <      Sort(>)  ...............  >\n"
        << "  Merge (list)  ..........  m      Merge (list,>)  ........  M\n"
-       << "  Reverse  ...............  R                                 \n"
+       << "  Reverse  ...............  R      Stats, MemoryUsage  ....  u\n"
        << "  Shuffle ..................$      Structure Test .........  !\n"
        << "  Display  ...............  D      Traverse  ..............  T\n"
        << "  Load data from file  ...  L      Write list to file  ....  W\n"
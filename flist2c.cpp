@@ -595,6 +595,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x1.Capacity() << " = x1.Capacity();\n";
 	    break;
 
+          case 'u':  case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x1.Stats() << " = x1.Stats();\n";
+            *osptr << "  " << x1.MemoryUsage() << " = x1.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x1.Sort();
@@ -1151,6 +1157,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x2.Capacity() << " = x2.Capacity();\n";
 	    break;
 
+          case 'u':  case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x2.Stats() << " = x2.Stats();\n";
+            *osptr << "  " << x2.MemoryUsage() << " = x2.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x2.Sort();
@@ -1707,6 +1719,12 @@ int main( int argc, char* argv[] )
             *osptr << "  " << x3.Capacity() << " = x3.Capacity();\n";
 	    break;
 
+          case 'u':  case 'U': // ListStats Stats()
+            if (BATCH) *osptr << '\n';
+            *osptr << "  " << x3.Stats() << " = x3.Stats();\n";
+            *osptr << "  " << x3.MemoryUsage() << " = x3.MemoryUsage();\n";
+	    break;
+
           case '<':   // void Sort()
             if (BATCH) *osptr << '\n';
             x3.Sort();
@@ -2002,7 +2020,7 @@ void DisplayMenu(std::ostream& os)
        << "  ++I  ...................  ++     --I  ...................  --\n"
        << "  Sort  ..................  <      Sort(>)  ...............  >\n"
        << "  Merge (list)  ..........  m      Merge (list,>)  ........  M\n"
-       << "  Reverse  ...............  R                                 \n"
+       << "  Reverse  ...............  R      Stats, MemoryUsage  ....  u\n"
        << "  Shuffle ..................$      Structure Test .........  !\n"
        << "  Display/Dump ...........  d      Traverse  ..............  t\n"
        << "  Load data from file  ...  L      Write list to file  ....  W\n"
@@ -0,0 +1,662 @@
+/*
+    ilist.cpp
+    Andrew J Wood
+
+    slave file to ilist.h
+
+    Implementation of the IntrusiveList<T,M> API, except for the macro-mutators
+    (mutators of entire list), which are in ilist_macro.cpp
+*/
+
+//----------------------------------
+//     IntrusiveList<T,M>:: Implementations
+//----------------------------------
+
+// stand-alone functions
+
+template < typename T , ListHook T::* M >
+bool operator == (const IntrusiveList<T,M>& x1, const IntrusiveList<T,M>& x2)
+{
+  if (x1.Size() != x2.Size())
+    return 0;
+  typename IntrusiveList<T,M>::ConstIterator i1, i2;
+  for (
+        i1 = x1.Begin(), i2 = x2.Begin();
+        (i1 != x1.End()) && (i2 != x2.End());
+        ++i1, ++i2
+      )
+  {
+    if (*(i1) != *(i2))
+      return 0;
+  }
+  if (i1 != x1.End() || i2 != x2.End())
+    return 0;
+  return 1;
+}
+
+template < typename T , ListHook T::* M >
+bool operator != (const IntrusiveList<T,M>& x1, const IntrusiveList<T,M>& x2)
+{
+  return !(x1 == x2);
+}
+
+template < typename T , ListHook T::* M >
+std::ostream& operator << (std::ostream& os, const IntrusiveList<T,M>& x2)
+{
+  x2.Display(os);
+  return os;
+}
+
+// protected methods
+
+template < typename T , ListHook T::* M >
+T * IntrusiveList<T,M>::Owner (ListHook * hook)
+// the element whose member M is hook [4]
+{
+  static typename std::aligned_storage < sizeof(T), alignof(T) >::type probe;
+  T * p = reinterpret_cast < T * > (&probe);
+  size_t offset = reinterpret_cast < char * > (&(p->*M)) - reinterpret_cast < char * > (p);
+  return reinterpret_cast < T * > (reinterpret_cast < char * > (hook) - offset);
+}
+
+template < typename T , ListHook T::* M >
+ListHook * IntrusiveList<T,M>::HookOf (T& t)
+{
+  return &(t.*M);
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::LinkIn (ListHook * location, ListHook * newLink)
+// link newLink into list at (ahead of) location
+{
+  InsertLink(location,newLink,LinkDirection<ListHook>());
+}
+
+template < typename T , ListHook T::* M >
+ListHook * IntrusiveList<T,M>::LinkOut (ListHook * oldLink)
+// unlink oldLink from list, return oldLink
+{
+  return EraseLink(oldLink);
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Transfer (ListHook * location, ListHook * first, ListHook * last)
+// unlink the non-empty chain [first,last) and link it into a list at (ahead of) location
+{
+  LinkDirection<ListHook> forward;
+  TransferLinks(location,forward,first,last,forward);
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Init ()
+{
+  head_.prev_ = nullptr;
+  head_.next_ = &tail_;
+  tail_.prev_ = &head_;
+  tail_.next_ = nullptr;
+  size_ = 0;
+}
+
+// constructors and assignment
+
+template < typename T , ListHook T::* M >
+IntrusiveList<T,M>::IntrusiveList () : head_(), tail_(), size_(0)
+{
+  Init();
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveList<T,M>::~IntrusiveList ()
+// the elements outlive the list, unlinked
+{
+  Clear();
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveList<T,M>::IntrusiveList (IntrusiveList&& x) : head_(), tail_(), size_(0)
+// takes the elements of x and leaves x empty
+{
+  Init();
+  Splice(End(),x);
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveList<T,M>& IntrusiveList<T,M>::operator = (IntrusiveList&& rhs)
+// exchanges elements with rhs, which takes the old elements
+{
+  if (this != &rhs)
+  {
+    IntrusiveList temp;
+    temp.Splice(temp.End(),*this);
+    Splice(End(),rhs);
+    rhs.Splice(rhs.End(),temp);
+  }
+  return *this;
+}
+
+// mutators
+
+template < typename T , ListHook T::* M >
+bool IntrusiveList<T,M>::PushFront (T& t)
+// link t in at the front (first) position [1]
+{
+  ListHook * hook = HookOf(t);
+  if (hook->Linked())
+  {
+    std::cerr << "** List error: PushFront() called with an element already on a list\n";
+    return 0;
+  }
+  LinkIn(head_.next_,hook);
+  ++size_;
+  return 1;
+}
+
+template < typename T , ListHook T::* M >
+bool IntrusiveList<T,M>::PushBack (T& t)
+// link t in at the back (last) position [1]
+{
+  ListHook * hook = HookOf(t);
+  if (hook->Linked())
+  {
+    std::cerr << "** List error: PushBack() called with an element already on a list\n";
+    return 0;
+  }
+  LinkIn(&tail_,hook);
+  ++size_;
+  return 1;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Insert (Iterator i, T& t)
+// link t in at (in front of) i; return i at t
+{
+  if (Empty())  // always insert
+  {
+    i = End();
+  }
+  if (!i.Valid() || i == rEnd()) // null or off-the-front
+  {
+    std::cerr << " ** cannot insert at position -1\n";
+    return End();
+  }
+  ListHook * hook = HookOf(t);
+  if (hook->Linked())
+  {
+    std::cerr << "** List error: Insert() called with an element already on a list\n";
+    return End();
+  }
+  LinkIn(i.curr_,hook);
+  ++size_;
+  i.curr_ = hook;
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Insert (T& t)
+{
+  return Insert(End(),t);
+}
+
+template < typename T , ListHook T::* M >
+bool IntrusiveList<T,M>::PopFront ()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopFront() called on empty list\n";
+    return 0;
+  }
+  LinkOut(head_.next_);
+  --size_;
+  return 1;
+}
+
+template < typename T , ListHook T::* M >
+bool IntrusiveList<T,M>::PopBack ()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopBack() called on empty list\n";
+    return 0;
+  }
+  LinkOut(tail_.prev_);
+  --size_;
+  return 1;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Remove (Iterator i)
+// unlink the element at i; return i at the next element
+{
+  // first deal with the impossible cases
+  if (i.curr_ == nullptr || i.curr_ == &head_ || i.curr_ == &tail_)
+  {
+    std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
+    return i;
+  }
+  i.curr_ = i.curr_->next_;  // advance iterator
+  LinkOut(i.curr_->prev_);   // unlink element to be removed
+  --size_;
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+size_t IntrusiveList<T,M>::Remove (const T& t)
+// unlink all elements equal to t
+{
+  size_t count(0);
+  Iterator i = Begin();
+  while (i != End())
+  {
+    if (t == *i)
+    {
+      i = Remove(i);
+      ++count;
+    }
+    else
+    {
+      ++i;
+    }
+  }
+  return (count);
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Clear ()
+// unlinks every element, leaving each hook unlinked
+{
+  ListHook * hook = head_.next_;
+  while (hook != &tail_)
+  {
+    ListHook * next = hook->next_;
+    hook->prev_ = nullptr;
+    hook->next_ = nullptr;
+    hook = next;
+  }
+  Init();
+}
+
+// accessors
+
+template < typename T , ListHook T::* M >
+size_t IntrusiveList<T,M>::Size () const
+// size_ is maintained by the mutators
+{
+  return size_;
+}
+
+template < typename T , ListHook T::* M >
+bool IntrusiveList<T,M>::Empty () const
+{
+  return (head_.next_ == &tail_);
+}
+
+template < typename T , ListHook T::* M >
+T& IntrusiveList<T,M>::Front ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T , ListHook T::* M >
+const T& IntrusiveList<T,M>::Front () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T , ListHook T::* M >
+T& IntrusiveList<T,M>::Back ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+template < typename T , ListHook T::* M >
+const T& IntrusiveList<T,M>::Back () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+// output methods
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Display (std::ostream& os, char ofc) const
+{
+  ConstIterator i;
+  if (ofc == '\0')
+    for (i = Begin(); i != End(); ++i)
+      os << *i;
+  else
+    for (i = Begin(); i != End(); ++i)
+      os << ofc << *i;
+} // Display()
+
+// debug/developer methods
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Dump (std::ostream& os, char ofc) const
+{
+  Display(os,ofc);
+  os << '\n';
+} // Dump()
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::CheckLinks (std::ostream& os) const
+{
+  const ListHook * p = &head_;
+  size_t n = 0;
+  for ( ; p != &tail_; p = p->next_, ++n)
+  {
+    if (p->next_ == nullptr || p->next_->prev_ != p)
+    {
+      os << " ** forward reciprocity failure at position " << n << '\n';
+      return;
+    }
+  }
+  if (n != size_ + 1)
+  {
+    os << " ** Size() mismatch: count = " << n - 1 << " , size = " << Size() << '\n';
+  }
+  if (head_.prev_ != nullptr || tail_.next_ != nullptr)
+  {
+    os << " ** head or tail not terminated\n";
+  }
+} // CheckLinks()
+
+// Iterator support
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Begin ()
+{
+  Iterator i(head_.next_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::End ()
+{
+  Iterator i(&tail_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::rBegin ()
+{
+  Iterator i(tail_.prev_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::rEnd ()
+{
+  Iterator i(&head_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Includes (const T& t)
+// sequential search
+{
+  Iterator i;
+  for (i = Begin(); i != End(); ++i)
+  {
+    if (t == *i)
+      return i;
+  }
+  return End();
+} // Includes()
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveList<T,M>::Locate (T& t)
+// the hook of t is its position [3]
+{
+  ListHook * hook = HookOf(t);
+  if (!hook->Linked())
+  {
+    std::cerr << "** List error: Locate() called with an element not on a list\n";
+    return End();
+  }
+  return Iterator(hook);
+}
+
+// ConstIterator support
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> IntrusiveList<T,M>::Begin () const
+{
+  ConstIterator i(head_.next_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> IntrusiveList<T,M>::End () const
+{
+  ConstIterator i(const_cast < ListHook * > (&tail_));
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> IntrusiveList<T,M>::rBegin () const
+{
+  ConstIterator i(tail_.prev_);
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> IntrusiveList<T,M>::rEnd () const
+{
+  ConstIterator i(const_cast < ListHook * > (&head_));
+  return i;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> IntrusiveList<T,M>::Includes (const T& t) const
+{
+  ConstIterator i;
+  for (i = Begin(); i != End(); ++i)
+  {
+    if (t == *i)
+      return i;
+  }
+  return End();
+} // Includes()
+
+//-------------------------------------------
+//     ConstIntrusiveListIterator<T,M>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>::ConstIntrusiveListIterator () : curr_(nullptr)
+{}
+
+// protected constructor
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>::ConstIntrusiveListIterator (ListHook * hook) : curr_(hook)
+// construct an iterator around a hook pointer (not available to client programs)
+{}
+
+// copy constructor
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>::ConstIntrusiveListIterator (const ConstIntrusiveListIterator<T,M>& i)
+   :  curr_(i.curr_)
+{}
+
+// assignment operator
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>& ConstIntrusiveListIterator<T,M>::operator = (const ConstIntrusiveListIterator<T,M>& i)
+{
+   curr_ = i.curr_;
+   return *this;
+}
+
+// protected method
+template < typename T , ListHook T::* M >
+T& ConstIntrusiveListIterator<T,M>::Retrieve () const
+// Return reference to current element
+// note conflicted signature - const method returns non-const reference
+{
+  if (curr_ == nullptr || curr_->prev_ == nullptr || curr_->next_ == nullptr) // head_ and tail_ hold no element [4]
+  {
+    std::cerr << "** Error: ConstIntrusiveListIterator<T,M>::Retrieve() invalid dereference\n";
+    exit (EXIT_FAILURE);
+  }
+  return *IntrusiveList<T,M>::Owner(curr_);
+}
+
+template < typename T , ListHook T::* M >
+bool ConstIntrusiveListIterator<T,M>::Valid () const
+// test cursor for legal position
+{
+  return curr_ != nullptr;
+}
+
+template < typename T , ListHook T::* M >
+bool ConstIntrusiveListIterator<T,M>::operator == (const ConstIntrusiveListIterator<T,M>& i2) const
+{
+  if (curr_ == i2.curr_)
+    return 1;
+  return 0;
+}
+
+template < typename T , ListHook T::* M >
+bool ConstIntrusiveListIterator<T,M>::operator != (const ConstIntrusiveListIterator<T,M>& i2) const
+{
+  return !(*this == i2);
+}
+
+template < typename T , ListHook T::* M >
+const T& ConstIntrusiveListIterator<T,M>::operator * () const
+{
+  return Retrieve();
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>& ConstIntrusiveListIterator<T,M>::operator ++ ()
+// prefix increment
+{
+  if (curr_ != nullptr)
+    curr_ = curr_->next_;
+  return *this;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> ConstIntrusiveListIterator<T,M>::operator ++ (int)
+// postfix increment
+{
+   ConstIntrusiveListIterator<T,M> clone = *this;
+   this->operator++();
+   return clone;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M>& ConstIntrusiveListIterator<T,M>::operator -- ()
+// prefix decrement
+{
+  if (curr_ != nullptr)
+    curr_ = curr_->prev_;
+  return *this;
+}
+
+template < typename T , ListHook T::* M >
+ConstIntrusiveListIterator<T,M> ConstIntrusiveListIterator<T,M>::operator -- (int)
+// postfix decrement
+{
+   ConstIntrusiveListIterator<T,M> clone = *this;
+   this->operator--();
+   return clone;
+}
+
+//-------------------------------------------
+//     IntrusiveListIterator<T,M>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>::IntrusiveListIterator () : ConstIntrusiveListIterator<T,M>()
+{}
+
+// protected constructor
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>::IntrusiveListIterator (ListHook * hook) : ConstIntrusiveListIterator<T,M>(hook)
+{}
+
+// initializing constructor
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>::IntrusiveListIterator (IntrusiveList<T,M>& x) : ConstIntrusiveListIterator<T,M>()
+{
+  this->curr_ = x.Begin().curr_;
+}
+
+// copy constructor
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>::IntrusiveListIterator (const IntrusiveListIterator<T,M>& i)
+   :  ConstIntrusiveListIterator<T,M>(i)
+{}
+
+// assignment operator
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>& IntrusiveListIterator<T,M>::operator = (const IntrusiveListIterator<T,M>& i)
+{
+  ConstIntrusiveListIterator<T,M>::operator=(i);
+  return *this;
+}
+
+template < typename T , ListHook T::* M >
+const T& IntrusiveListIterator<T,M>::operator * () const
+{
+  return ConstIntrusiveListIterator<T,M>::Retrieve();
+}
+
+template < typename T , ListHook T::* M >
+T& IntrusiveListIterator<T,M>::operator * ()
+{
+  return ConstIntrusiveListIterator<T,M>::Retrieve();
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>& IntrusiveListIterator<T,M>::operator ++ ()
+// prefix increment
+{
+  ConstIntrusiveListIterator<T,M>::operator++();
+  return *this;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveListIterator<T,M>::operator ++ (int)
+// postfix increment
+{
+   IntrusiveListIterator<T,M> clone = *this;
+   this->operator++();
+   return clone;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M>& IntrusiveListIterator<T,M>::operator -- ()
+// prefix decrement
+{
+  ConstIntrusiveListIterator<T,M>::operator--();
+  return *this;
+}
+
+template < typename T , ListHook T::* M >
+IntrusiveListIterator<T,M> IntrusiveListIterator<T,M>::operator -- (int)
+// postfix decrement
+{
+   IntrusiveListIterator<T,M> clone = *this;
+   this->operator--();
+   return clone;
+}
@@ -0,0 +1,309 @@
+/*
+    ilist.h
+    Andrew J Wood
+
+    Definition of the fsu::IntrusiveList<T,M> API
+
+    An intrusive list does not allocate links or copy elements: the prev and
+    next pointers live in a member of type fsu::ListHook inside T, and the
+    list threads the client's own objects together through that member. M
+    names the member, so one object may be on several lists at once through
+    several hooks:
+
+      struct Job
+      {
+        long           id;
+        fsu::ListHook  byQueue;   // place on a queue
+        fsu::ListHook  byOwner;   // place on its owner's list
+      } ;
+
+      fsu::IntrusiveList < Job , &Job::byQueue > queue;
+      fsu::IntrusiveList < Job , &Job::byOwner > owned;
+
+    The interface follows fsu::List<T> (list.h), except that elements are
+    passed by reference and are never owned by the list [1]. Sort, Merge,
+    Reverse and Splice relink hooks only, so they touch no allocator and
+    never copy or move an element. Sort is the bottom-up merge sort of
+    fsu::List (list_sort.cpp).
+*/
+
+#ifndef _ILIST_H
+#define _ILIST_H
+
+#include <iostream>    // class ostream and objects cerr, cout
+#include <cstdlib>     // EXIT_FAILURE, size_t
+#include <type_traits> // std::aligned_storage
+#include <compare.h>   // needed for Sort()
+#include <list.h>      // SortLinks and the relinking of list_sort.cpp, list_link.cpp
+
+namespace fsu
+{
+
+  class ListHook;
+
+  template < typename T , ListHook T::* M >
+  class IntrusiveList;
+
+  template < typename T , ListHook T::* M >
+  class ConstIntrusiveListIterator;
+
+  template < typename T , ListHook T::* M >
+  class IntrusiveListIterator;
+
+  //----------------------------------
+  //     ListHook
+  //----------------------------------
+
+  class ListHook
+  {
+  public:
+    ListHook  () : prev_(nullptr), next_(nullptr) {}
+    ListHook  (const ListHook& ) : prev_(nullptr), next_(nullptr) {} // a copy is on no list [2]
+    ListHook& operator = (const ListHook& ) { return *this; }       // keeps its own place
+
+    bool Linked () const { return next_ != nullptr; } // true iff the element is on a list
+
+  private:
+    template < typename T , ListHook T::* M >
+    friend class IntrusiveList;
+    template < typename T , ListHook T::* M >
+    friend class ConstIntrusiveListIterator;
+    template < class L , class P , class V >
+    friend void SortLinks (L * head, L * tail, P& comp, V value); // list_sort.cpp
+    template < class L >
+    friend class LinkDirection; // the relinking of list_link.cpp
+
+    ListHook *  prev_;
+    ListHook *  next_;
+  } ;
+
+  //----------------------------------
+  //     IntrusiveList<T,M>
+  //----------------------------------
+
+  template < typename T , ListHook T::* M >
+  class IntrusiveList
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef IntrusiveListIterator < T , M >        Iterator;
+    typedef ConstIntrusiveListIterator < T , M >   ConstIterator;
+
+    // constructors and assignment
+                    IntrusiveList ();                    // default constructor
+    virtual         ~IntrusiveList ();                   // unlinks every element
+                    IntrusiveList (IntrusiveList&& );    // move constructor; argument left empty
+    IntrusiveList&  operator =    (IntrusiveList&& );    // move assignment; exchanges elements
+
+    // modifying List structure - mutators [1]
+    bool      PushFront  (T& t);             // link t in at front of list
+    bool      PushBack   (T& t);             // link t in at back of list
+    Iterator  Insert     (Iterator i, T& t); // link t in at i
+    Iterator  Insert     (T& t);             // link t in at back
+
+    bool      PopFront  ();              // unlink the element at front
+    bool      PopBack   ();              // unlink the element at back
+    Iterator  Remove    (Iterator i);    // unlink the element at i
+    size_t    Remove    (const T& t);    // unlink all elements equal to t
+    void      Clear     ();              // unlink every element
+
+    // macroscopic (whole list) mutators
+    void      Sort      ();                     // default order <
+    void      Merge     (IntrusiveList& list);  // merges "list" into this list
+    void      Reverse   ();
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Sort      (Predicate& p);
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Merge     (IntrusiveList& list, Predicate& p);
+
+    // moving elements between lists
+    void      Splice    (Iterator pos, IntrusiveList& list);             // all of list, ahead of pos
+    void      Splice    (Iterator pos, IntrusiveList& list, Iterator i); // element i of list
+    void      Splice    (Iterator pos, IntrusiveList& list, Iterator first, Iterator last); // [first,last)
+
+    // information about the list - accessors
+    size_t    Size  () const;  // return the number of elements on the list
+    bool      Empty () const;  // true iff list has no elements
+
+    // accessing values on the list - more accessors
+    T&        Front ();        // return reference to element at front of list
+    const T&  Front () const;  // const version
+    T&        Back  ();        // return reference to element at back of list
+    const T&  Back  () const;  // const version
+
+    // Iterator support - locating places on the list
+    Iterator  Begin      (); // return iterator to front
+    Iterator  End        (); // return iterator "1 past the back"
+    Iterator  rBegin     (); // return iterator to back
+    Iterator  rEnd       (); // return iterator "1 past the front" in reverse
+    Iterator  Includes   (const T& t); // returns position of first element equal to t, or End()
+    Iterator  Locate     (T& t);       // position of t itself, which must be on this list [3]
+
+    // ConstIterator support
+    ConstIterator  Begin      () const;
+    ConstIterator  End        () const;
+    ConstIterator  rBegin     () const;
+    ConstIterator  rEnd       () const;
+    ConstIterator  Includes   (const T& t) const;
+
+    // generic display methods
+    void Display (std::ostream& os, char ofc = '\0') const;
+    void Dump    (std::ostream& os, char ofc = '\0') const;
+
+    // structural integrity check
+    void CheckLinks(std::ostream& os = std::cout) const;
+
+  protected:
+    ListHook  head_,  // hook representing "one before the first"
+              tail_;  // hook representing "one past the last"
+    size_t    size_;  // number of elements on the list
+
+    // protected methods -- used only by other methods
+    void Init ();  // links head_ to tail_
+
+    // the element holding hook, and the hook of an element [4]
+    static T *        Owner  (ListHook * hook);
+    static ListHook * HookOf (T& t);
+
+    // standard link-in and link-out processes, those of fsu::List (list_link.cpp)
+    static void       LinkIn   (ListHook * location, ListHook * newLink);
+    static ListHook * LinkOut  (ListHook * oldLink);
+    static void       Transfer (ListHook * location, ListHook * first, ListHook * last); // [first,last) ahead of location
+
+    // elements cannot be shared by two lists through one hook
+    IntrusiveList (const IntrusiveList& ) = delete;
+    IntrusiveList& operator = (const IntrusiveList& ) = delete;
+
+    // tight couplings
+    friend class IntrusiveListIterator<T,M>;
+    friend class ConstIntrusiveListIterator<T,M>;
+  } ;
+
+  // global scope operators and functions
+
+  template < typename T , ListHook T::* M >
+  bool operator == (const IntrusiveList<T,M>& list1, const IntrusiveList<T,M>& list2);
+
+  template < typename T , ListHook T::* M >
+  bool operator != (const IntrusiveList<T,M>& list1, const IntrusiveList<T,M>& list2);
+
+  template < typename T , ListHook T::* M >
+  std::ostream& operator << (std::ostream& os, const IntrusiveList<T,M>& list);
+
+  //----------------------------------
+  //     ConstIntrusiveListIterator<T,M>
+  //----------------------------------
+
+  template < typename T , ListHook T::* M >
+  class ConstIntrusiveListIterator
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstIntrusiveListIterator < T , M >   ConstIterator;
+    typedef IntrusiveListIterator < T , M >        Iterator;
+
+    // constructors
+    ConstIntrusiveListIterator       ();                                   // default constructor
+    ConstIntrusiveListIterator       (const ConstIntrusiveListIterator& ); // copy constructor
+
+    // information/access
+    bool Valid         () const;  // cursor is valid position
+
+    // various operators
+    bool            operator == (const ConstIterator& i2) const;
+    bool            operator != (const ConstIterator& i2) const;
+    const T&        operator *  () const; // Return const reference to current element
+    ConstIterator&  operator =  (const ConstIterator& i);
+    ConstIterator&  operator ++ ();    // prefix
+    ConstIterator   operator ++ (int); // postfix
+    ConstIterator&  operator -- ();    // prefix
+    ConstIterator   operator -- (int); // postfix
+
+  protected:
+    // data
+    ListHook * curr_;
+
+    // methods
+    ConstIntrusiveListIterator (ListHook * hook); // type converting constructor
+    T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
+
+    // tight couplings
+    friend class IntrusiveList<T,M>;
+  } ;
+
+  //----------------------------------
+  //     IntrusiveListIterator<T,M>
+  //----------------------------------
+
+  template < typename T , ListHook T::* M >
+  class IntrusiveListIterator : public ConstIntrusiveListIterator<T,M>
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstIntrusiveListIterator < T , M >   ConstIterator;
+    typedef IntrusiveListIterator < T , M >        Iterator;
+
+    // constructors
+    IntrusiveListIterator       ();                                // default constructor
+    IntrusiveListIterator       (IntrusiveList<T,M>& );            // initializing constructor
+    IntrusiveListIterator       (const IntrusiveListIterator& );   // copy constructor
+
+    // various operators
+    T&         operator *  ();       // Return reference to current element
+    const T&   operator *  () const; // const version
+    Iterator&  operator =  (const Iterator& i);
+    Iterator&  operator ++ ();    // prefix
+    Iterator   operator ++ (int); // postfix
+    Iterator&  operator -- ();    // prefix
+    Iterator   operator -- (int); // postfix
+
+  protected:
+    // methods
+    IntrusiveListIterator (ListHook * hook); // type converting constructor
+
+    // tight couplings
+    friend class IntrusiveList<T,M>;
+  } ;
+
+#include <ilist.cpp>
+#include <ilist_macro.cpp>
+
+} // namespace fsu
+
+/* Notes
+   =====
+
+[1] The list links the client's objects; it never allocates, copies,
+    constructs or destroys an element. PushFront, PushBack and Insert
+    link t itself in, and fail with a message if t is already on a list
+    through the same hook. Pop, Remove, Clear and the destructor unlink
+    elements and leave them to the client. An element must therefore stay
+    at its address while linked, and must be unlinked before it is
+    destroyed. Operations that copy elements, such as the copy
+    constructor, assignment and Clone of fsu::List, are not provided.
+
+[2] Copying an element copies its data but not its place: the hook of the
+    copy is unlinked, and assigning to a linked element leaves it where it
+    is. Linked() tells whether the element is on some list through the
+    hook.
+
+[3] Locate(t) is the position of an element already known to be on this
+    list, found in constant time from its hook, so Remove(Locate(t)) and
+    Insert(Locate(t),u) cost O(1). Splice, like that of fsu::List, may move
+    elements between two lists using the same hook, and list may be this
+    list for the single element and range versions, in which case pos must
+    not lie inside the range.
+
+[4] Owner recovers the element from the address of its hook using the
+    offset of M in T, which is fixed for the type. T should be a standard
+    layout class, and M a member of T itself rather than of a base class.
+    head_ and tail_ are hooks of the list object itself and belong to no
+    element; dereferencing End() or rEnd() is an error.
+*/
+
+#endif
@@ -0,0 +1,126 @@
+/*
+    ilist_macro.cpp
+    Andrew J Wood
+
+    slave file to ilist.h
+
+    Implementation of IntrusiveList<T,M>:: macroscopic (whole list) mutators
+    Sort, Merge, Reverse, Splice
+
+    These follow list_macro.cpp, with hooks in place of links, and share
+    its merge and relinking (list_link.cpp). No element is copied or moved
+    and nothing is allocated.
+*/
+
+//----------------------------------
+//     IntrusiveList<T,M>::Sort Implementations
+//----------------------------------
+
+template < typename T , ListHook T::* M >
+template < class P >
+void IntrusiveList<T,M>::Sort (P& comp)
+// bottom-up merge sort of the hooks, in list_sort.cpp
+{
+  SortLinks(&head_,&tail_,comp,[] (ListHook * hook) -> T& { return *Owner(hook); });
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
+//-----------------------------------
+//     IntrusiveList<T,M>::Merge Implementations
+//-----------------------------------
+
+template < typename T , ListHook T::* M >
+template < class P >
+void IntrusiveList<T,M>::Merge (IntrusiveList& y, P& p)
+// merges y into this list; post: true = y.Empty()
+// if both lists are ordered result is ordered
+{
+  if (this == &y) return;
+  LinkDirection<ListHook> forward;
+  MergeLinks(&head_,&tail_,forward,&y.head_,&y.tail_,forward,p,
+             [] (ListHook * hook) -> T& { return *Owner(hook); });
+
+  // all of y's elements now belong to this list
+  size_ += y.size_;
+  y.size_ = 0;
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Merge (IntrusiveList& y)
+{
+  fsu::LessThan<T> p;
+  Merge(y,p);
+}
+
+//------------------------------------
+//     IntrusiveList<T,M>::Splice Implementations
+//------------------------------------
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Splice (Iterator pos, IntrusiveList& y)
+// moves all elements of y ahead of pos; post: y.Empty()
+{
+  if (this == &y || y.head_.next_ == &y.tail_) return;
+  if (!pos.Valid() || pos.curr_ == &head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid position\n";
+    return;
+  }
+  Transfer(pos.curr_,y.head_.next_,&y.tail_);
+  size_ += y.size_;
+  y.size_ = 0;
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Splice (Iterator pos, IntrusiveList& y, Iterator i)
+// moves the element at i in y ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == &head_ || !i.Valid() || i.curr_ == &y.head_ || i.curr_ == &y.tail_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (pos.curr_ == i.curr_ || pos.curr_ == i.curr_->next_) return; // already in place
+  Transfer(pos.curr_,i.curr_,i.curr_->next_);
+  ++size_;
+  --y.size_;
+}
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Splice (Iterator pos, IntrusiveList& y, Iterator first, Iterator last)
+// moves the elements of y in [first,last) ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == &head_ || !first.Valid() || !last.Valid() || first.curr_ == &y.head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (first == last || pos == first || pos == last) return; // nothing to move, or already in place
+  if (this != &y)
+  {
+    size_t n = 0;
+    for (ListHook * hook = first.curr_; hook != last.curr_; hook = hook->next_)
+      ++n;
+    size_ += n;
+    y.size_ -= n;
+  }
+  Transfer(pos.curr_,first.curr_,last.curr_);
+}
+
+//------------------------------------
+//     IntrusiveList<T,M>::Reverse Implementation
+//------------------------------------
+
+template < typename T , ListHook T::* M >
+void IntrusiveList<T,M>::Reverse ()
+// head_ and tail_ stay where they are, so only the hooks between them are
+// reversed and then reattached
+{
+  ReverseChain(&head_,&tail_);
+}
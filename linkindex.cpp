@@ -0,0 +1,606 @@
+/*
+    linkindex.cpp
+    Andrew J Wood
+
+    slave file to linkindex.h
+
+    Implementation of the index policies NoIndex, SkipIndex and HashIndex<H>
+
+    SkipIndex is an indexable skip list. Level 0 is the list itself; a link
+    with a tower of height h is also on levels 1 .. h, where it records its
+    neighbours and the number of links from it to its successor (the width).
+    The rank of a link is the sum of the widths on any path to it from the
+    head, so Locate descends from the head adding widths, and Rank climbs
+    from the link back to the head adding widths. Heights are geometric with
+    p = 1/4, so about a quarter of the links have a tower at all.
+*/
+
+//----------------------------------
+//     NoIndex:: Implementations
+//----------------------------------
+
+template < class L >
+size_t NoIndex::Rank (const L * link)
+// walk back to the head
+{
+  size_t rank = 0;
+  for ( ; link->prev_ != nullptr; link = link->prev_)
+    ++rank;
+  return rank;
+}
+
+template < class L >
+L * NoIndex::Locate (L * head, size_t rank)
+// walk forward from the head
+{
+  for ( ; rank > 0 && head->next_ != nullptr; --rank)
+    head = head->next_;
+  return head;
+}
+
+template < class L , typename T >
+L * NoIndex::Find (L * from, L * tail, const T& t)
+// sequential search
+{
+  for ( ; from != tail; from = from->next_)
+  {
+    if (t == from->Tval_)
+      return from;
+  }
+  return tail;
+}
+
+template < class L , typename T >
+L * NoIndex::FindBack (L * from, L * head, const T& t)
+// sequential search toward the head
+{
+  for ( ; from != head; from = from->prev_)
+  {
+    if (t == from->Tval_)
+      return from;
+  }
+  return head;
+}
+
+//----------------------------------
+//     SkipIndex:: Implementations
+//----------------------------------
+
+inline size_t SkipIndex::Height (const void * link)
+// geometric with p = 1/4 from a hash of the address, so that lists on
+// different threads share no generator state
+{
+  uint64_t x = reinterpret_cast < uintptr_t > (link);
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  size_t height = 0;
+  while ((x & 3) == 0 && height + 1 < maxHeight)
+  {
+    ++height;
+    x >>= 2;
+  }
+  return height;
+}
+
+inline bool SkipIndex::Build (Hook * hook, size_t height)
+// give hook a tower of the given height; on failure hook keeps no tower
+{
+  if (height == 0)
+    return 1;
+  hook->up_ = new(std::nothrow) Hook::Level [height];
+  if (hook->up_ == nullptr)
+    return 0;
+  hook->height_ = height;
+  return 1;
+}
+
+inline void SkipIndex::Drop (Hook * hook)
+{
+  delete [] hook->up_;
+  hook->up_ = nullptr;
+  hook->height_ = 0;
+}
+
+template < class L >
+SkipIndex::Hook * SkipIndex::Climb (const L * link, size_t& rank)
+// walk back to the nearest tower, then up and back along the top of each
+// tower until the head is reached
+{
+  rank = 0;
+  for ( ; link->prev_ != nullptr && static_cast < const Hook * > (link)->height_ == 0; link = link->prev_)
+    ++rank;
+  const Hook * hook = link;
+  while (hook->height_ > 0)
+  {
+    size_t top = hook->height_ - 1;
+    const Hook * prev = hook->up_[top].prev_;
+    if (prev == nullptr) // hook is the head
+      break;
+    rank += prev->up_[top].width_;
+    hook = prev;
+  }
+  return const_cast < Hook * > (hook);
+}
+
+inline void SkipIndex::Descend (Hook * head, size_t rank, Hook ** pred, size_t * predRank)
+{
+  Hook * hook = head;
+  size_t pos = 0;
+  for (size_t l = maxHeight; l-- > 0; )
+  {
+    while (hook->up_[l].next_ != nullptr && pos + hook->up_[l].width_ < rank)
+    {
+      pos += hook->up_[l].width_;
+      hook = hook->up_[l].next_;
+    }
+    pred[l] = hook;
+    predRank[l] = pos;
+  }
+}
+
+template < class L >
+void SkipIndex::Init (L * head, L * tail)
+// head and tail get full towers, adjacent on every level
+{
+  Hook * h = head, * t = tail;
+  if (!Build(h,maxHeight) || !Build(t,maxHeight))
+  {
+    // the list works without an index; Rank and Locate walk the links
+    std::cerr << "** List error: memory allocation failure\n";
+    Drop(h);
+    Drop(t);
+    return;
+  }
+  for (size_t l = 0; l < maxHeight; ++l)
+  {
+    h->up_[l].prev_  = nullptr;
+    h->up_[l].next_  = t;
+    h->up_[l].width_ = 1;
+    t->up_[l].prev_  = h;
+    t->up_[l].next_  = nullptr;
+    t->up_[l].width_ = 0;
+  }
+}
+
+template < class L >
+void SkipIndex::LinkedIn (L * link)
+// link (now at level 0) splits the towers spanning it on its own levels and
+// widens them on the levels above
+{
+  size_t rank;
+  Hook * head = Climb(link->prev_,rank);
+  if (head->height_ == 0)
+    return;
+  ++rank;
+  Hook * x = link;
+  if (x->height_ == 0)
+    Build(x,Height(link)); // a link without a tower is still counted
+  Hook * pred[maxHeight];
+  size_t predRank[maxHeight];
+  Descend(head,rank,pred,predRank);
+  for (size_t l = 0; l < maxHeight; ++l)
+  {
+    Hook::Level & p = pred[l]->up_[l];
+    if (l < x->height_)
+    {
+      Hook::Level & q = x->up_[l];
+      q.width_ = predRank[l] + p.width_ + 1 - rank;
+      q.prev_  = pred[l];
+      q.next_  = p.next_;
+      q.next_->up_[l].prev_ = x;
+      p.width_ = rank - predRank[l];
+      p.next_  = x;
+    }
+    else
+    {
+      ++p.width_;
+    }
+  }
+}
+
+template < class L >
+void SkipIndex::LinkingOut (L * link)
+// the reverse of LinkedIn; link loses its tower
+{
+  size_t rank;
+  Hook * head = Climb(link,rank);
+  Hook * x = link;
+  if (head->height_ != 0)
+  {
+    Hook * pred[maxHeight];
+    size_t predRank[maxHeight];
+    Descend(head,rank,pred,predRank);
+    for (size_t l = 0; l < maxHeight; ++l)
+    {
+      Hook::Level & p = pred[l]->up_[l];
+      if (l < x->height_)
+      {
+        Hook::Level & q = x->up_[l];
+        p.width_ += q.width_ - 1;
+        p.next_   = q.next_;
+        q.next_->up_[l].prev_ = pred[l];
+      }
+      else
+      {
+        --p.width_;
+      }
+    }
+  }
+  Drop(x);
+}
+
+template < class L >
+void SkipIndex::Rebuild (L * head, L * tail)
+// relink every tower from scratch in one pass over the links; towers stay
+// with their links, so the heights keep their distribution
+{
+  Hook * h = head;
+  if (h->height_ == 0)
+  {
+    for (L * link = head->next_; link != nullptr; link = link->next_)
+      Drop(link);
+    return;
+  }
+  Hook * last[maxHeight];
+  size_t lastRank[maxHeight];
+  for (size_t l = 0; l < maxHeight; ++l)
+  {
+    h->up_[l].prev_ = nullptr;
+    last[l] = h;
+    lastRank[l] = 0;
+  }
+  size_t rank = 0;
+  for (L * link = head; link != tail; )
+  {
+    link = link->next_;
+    ++rank;
+    Hook * x = link;
+    for (size_t l = 0; l < x->height_; ++l)
+    {
+      last[l]->up_[l].next_  = x;
+      last[l]->up_[l].width_ = rank - lastRank[l];
+      x->up_[l].prev_ = last[l];
+      last[l] = x;
+      lastRank[l] = rank;
+    }
+  }
+  for (size_t l = 0; l < maxHeight; ++l)
+  {
+    last[l]->up_[l].next_  = nullptr;
+    last[l]->up_[l].width_ = 0;
+  }
+}
+
+template < class L >
+size_t SkipIndex::Rank (const L * link)
+{
+  size_t rank;
+  Climb(link,rank);
+  return rank;
+}
+
+template < class L >
+L * SkipIndex::Locate (L * head, size_t rank)
+// descend from the head, then walk the last few links
+{
+  Hook * hook = head;
+  size_t pos = 0;
+  for (size_t l = hook->height_; l-- > 0; )
+  {
+    while (hook->up_[l].next_ != nullptr && pos + hook->up_[l].width_ <= rank)
+    {
+      pos += hook->up_[l].width_;
+      hook = hook->up_[l].next_;
+    }
+  }
+  L * link = static_cast < L * > (hook);
+  for ( ; pos < rank && link->next_ != nullptr; ++pos)
+    link = link->next_;
+  return link;
+}
+
+template < class L , typename T >
+L * SkipIndex::Find (L * from, L * tail, const T& t)
+// sequential search; the skip list orders links by position, not value
+{
+  for ( ; from != tail; from = from->next_)
+  {
+    if (t == from->Tval_)
+      return from;
+  }
+  return tail;
+}
+
+template < class L , typename T >
+L * SkipIndex::FindBack (L * from, L * head, const T& t)
+// sequential search toward the head
+{
+  for ( ; from != head; from = from->prev_)
+  {
+    if (t == from->Tval_)
+      return from;
+  }
+  return head;
+}
+
+template < class L >
+bool SkipIndex::Check (const L * head, const L * tail, std::ostream& os)
+// every tower must be linked to the previous tower of its height, at the right distance
+{
+  const Hook * h = head;
+  if (h->height_ == 0)
+    return 1;
+  const Hook * last[maxHeight];
+  size_t lastRank[maxHeight];
+  for (size_t l = 0; l < maxHeight; ++l)
+  {
+    last[l] = h;
+    lastRank[l] = 0;
+  }
+  size_t rank = 0;
+  for (const L * link = head; link != tail; )
+  {
+    link = link->next_;
+    ++rank;
+    const Hook * x = link;
+    for (size_t l = 0; l < x->height_; ++l)
+    {
+      if (last[l]->up_[l].next_ != x || x->up_[l].prev_ != last[l] || last[l]->up_[l].width_ != rank - lastRank[l])
+      {
+        os << " ** index failure at position " << rank - 1 << ", level " << l + 1 << '\n';
+        return 0;
+      }
+      last[l] = x;
+      lastRank[l] = rank;
+    }
+  }
+  return 1;
+}
+
+template < class L >
+size_t SkipIndex::Bytes (const L * head, const L * tail)
+// the towers, head and tail included
+{
+  const Hook * h = tail;
+  size_t bytes = h->height_ * sizeof(Hook::Level);
+  for (const L * link = head; link != tail; link = link->next_)
+  {
+    h = link;
+    bytes += h->height_ * sizeof(Hook::Level);
+  }
+  return bytes;
+}
+
+//----------------------------------
+//     HashIndex<H>:: Implementations
+//----------------------------------
+
+// The table chains the Hooks of the links through chain_, so a link costs
+// two words and no allocation of its own. The table doubles when it holds
+// more links than buckets and is never shrunk, except by Init.
+
+template < class H >
+HashIndex<H>::HashIndex () : bucket_(nullptr), buckets_(0), count_(0), hash_()
+{}
+
+template < class H >
+HashIndex<H>::~HashIndex ()
+{
+  delete [] bucket_;
+}
+
+template < class H >
+HashIndex<H>::HashIndex (HashIndex&& x) : bucket_(x.bucket_), buckets_(x.buckets_), count_(x.count_), hash_(x.hash_)
+{
+  x.bucket_ = nullptr;
+  x.buckets_ = 0;
+  x.count_ = 0;
+}
+
+template < class H >
+HashIndex<H>& HashIndex<H>::operator = (HashIndex&& x)
+{
+  std::swap(bucket_,x.bucket_);
+  std::swap(buckets_,x.buckets_);
+  std::swap(count_,x.count_);
+  std::swap(hash_,x.hash_);
+  return *this;
+}
+
+template < class H >
+bool HashIndex<H>::Resize (size_t buckets)
+// on allocation failure the old table is kept, with longer chains
+{
+  Hook ** bucket = new(std::nothrow) Hook* [buckets] ();
+  if (bucket == nullptr)
+    return 0;
+  Hook ** old = bucket_;
+  size_t oldBuckets = buckets_;
+  bucket_ = bucket;
+  buckets_ = buckets;
+  for (size_t b = 0; b < oldBuckets; ++b)
+  {
+    Hook * hook = old[b];
+    while (hook != nullptr)
+    {
+      Hook * next = hook->chain_;
+      Insert(hook);
+      hook = next;
+    }
+  }
+  delete [] old;
+  return 1;
+}
+
+template < class H >
+void HashIndex<H>::Insert (Hook * hook)
+// push hook onto its bucket; hook->hash_ is already set
+{
+  Hook *& bucket = bucket_[hook->hash_ & (buckets_ - 1)];
+  hook->chain_ = bucket;
+  bucket = hook;
+}
+
+template < class H >
+template < class L >
+void HashIndex<H>::Init (L * , L * )
+// an empty list starts with a small empty table
+{
+  delete [] bucket_;
+  bucket_ = nullptr;
+  buckets_ = 0;
+  count_ = 0;
+  if (!Resize(16))
+    std::cerr << "** List error: memory allocation failure\n";
+}
+
+template < class H >
+template < class L >
+void HashIndex<H>::LinkedIn (L * link)
+{
+  if (buckets_ == 0)
+    return;
+  Hook * hook = link;
+  hook->hash_ = hash_(link->Tval_);
+  Insert(hook);
+  if (++count_ > buckets_)
+    Resize(2 * buckets_);
+}
+
+template < class H >
+template < class L >
+void HashIndex<H>::LinkingOut (L * link)
+// unlink by address, using the hash cached when link joined
+{
+  if (buckets_ == 0)
+    return;
+  Hook * hook = link;
+  Hook ** p = &bucket_[hook->hash_ & (buckets_ - 1)];
+  while (*p != nullptr && *p != hook)
+    p = &(*p)->chain_;
+  if (*p == nullptr)
+    return;
+  *p = hook->chain_;
+  hook->chain_ = nullptr;
+  --count_;
+}
+
+template < class H >
+template < class L >
+void HashIndex<H>::Rebuild (L * head, L * tail)
+// empty the table and hash the links between head and tail again
+{
+  if (buckets_ == 0 && !Resize(16))
+    return;
+  for (size_t b = 0; b < buckets_; ++b)
+    bucket_[b] = nullptr;
+  count_ = 0;
+  for (L * link = head->next_; link != tail; link = link->next_)
+  {
+    Hook * hook = link;
+    hook->hash_ = hash_(link->Tval_);
+    Insert(hook);
+    if (++count_ > buckets_)
+      Resize(2 * buckets_);
+  }
+}
+
+template < class H >
+template < class L >
+size_t HashIndex<H>::Rank (const L * link)
+// walk back to the head
+{
+  size_t rank = 0;
+  for ( ; link->prev_ != nullptr; link = link->prev_)
+    ++rank;
+  return rank;
+}
+
+template < class H >
+template < class L >
+L * HashIndex<H>::Locate (L * head, size_t rank)
+// walk forward from the head
+{
+  for ( ; rank > 0 && head->next_ != nullptr; --rank)
+    head = head->next_;
+  return head;
+}
+
+template < class H >
+template < class L , typename T >
+L * HashIndex<H>::Find (L * from, L * tail, const T& t) const
+// any link in the list holding t; the links ahead of from are not excluded
+{
+  if (buckets_ == 0)
+  {
+    for ( ; from != tail; from = from->next_)
+    {
+      if (t == from->Tval_)
+        return from;
+    }
+    return tail;
+  }
+  size_t hash = hash_(t);
+  for (Hook * hook = bucket_[hash & (buckets_ - 1)]; hook != nullptr; hook = hook->chain_)
+  {
+    if (hook->hash_ == hash && t == static_cast < L * > (hook)->Tval_)
+      return static_cast < L * > (hook);
+  }
+  return tail;
+}
+
+template < class H >
+template < class L , typename T >
+L * HashIndex<H>::FindBack (L * from, L * head, const T& t) const
+// as Find, walking toward the head when there is no table
+{
+  if (buckets_ == 0)
+  {
+    for ( ; from != head; from = from->prev_)
+    {
+      if (t == from->Tval_)
+        return from;
+    }
+    return head;
+  }
+  return Find(from,head,t);
+}
+
+template < class H >
+template < class L >
+bool HashIndex<H>::Check (const L * head, const L * tail, std::ostream& os) const
+// every link must be in the bucket of its current value
+{
+  if (buckets_ == 0)
+    return 1;
+  size_t n = 0;
+  for (const L * link = head->next_; link != tail; link = link->next_, ++n)
+  {
+    const Hook * hook = link;
+    const Hook * found = bucket_[hook->hash_ & (buckets_ - 1)];
+    while (found != nullptr && found != hook)
+      found = found->chain_;
+    if (found == nullptr || hook->hash_ != hash_(link->Tval_))
+    {
+      os << " ** hash index failure at position " << n << '\n';
+      return 0;
+    }
+  }
+  if (n != count_)
+  {
+    os << " ** hash index count mismatch: count = " << n << " , indexed = " << count_ << '\n';
+    return 0;
+  }
+  return 1;
+}
+
+template < class H >
+template < class L >
+size_t HashIndex<H>::Bytes (const L * , const L * ) const
+// the bucket array; the chains live in the Hooks
+{
+  return buckets_ * sizeof(Hook*);
+}
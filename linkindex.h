@@ -0,0 +1,184 @@
+/*
+    linkindex.h
+    Andrew J Wood
+
+    Definition of the index policies fsu::NoIndex, fsu::SkipIndex and
+    fsu::HashIndex<H>
+
+    An index policy is the second template argument of fsu::List<T,I> and
+    alt2c::List<T,I>. It supplies a Hook, which is a base class of every
+    link and so holds the per-link data of the index. Each list holds one
+    policy object, index_, and calls it as links join and leave the list or
+    the list is restructured:
+
+      Init       (head, tail)  head and tail of a new empty list
+      LinkedIn   (link)        link has just joined the list
+      LinkingOut (link)        link is about to leave the list
+      Rebuild    (head, tail)  links were moved or changed wholesale (Sort, Splice, ..)
+      Rank       (link)        number of links ahead of link, head included
+      Locate     (head, rank)  the link at rank, or the tail if rank is too big
+      Find       (from, tail, t)   a link in [from,tail) holding t, or tail
+      FindBack   (from, head, t)   the same walking prev_ to head, or head (reversed lists)
+      Check      (head, tail, os)  consistency check for CheckLinks
+      Bytes      (head, tail)  heap bytes held by the index beyond the Hooks, for Stats
+
+    NoIndex has an empty Hook and walks the links for Rank, Locate and
+    Find, so a plain List pays nothing for the index. SkipIndex keeps an
+    indexable skip list over the links and answers Rank and Locate in
+    O(log n) expected time, at the cost of O(log n) work in LinkedIn and
+    LinkingOut and O(n) in Rebuild. HashIndex<H> keeps a hash table of the
+    links keyed by value, so Find takes O(1) expected time; it may return
+    any link in the list holding t, not the first one after from.
+
+    A link class L using a policy must derive from its Hook, must have
+    members Tval_, prev_ and next_, and must befriend the policy. Rank,
+    Locate and SkipIndex need nullptr beyond the head and tail, so the
+    ring of alt2c::List can use NoIndex and HashIndex only.
+*/
+
+#ifndef _LINKINDEX_H
+#define _LINKINDEX_H
+
+#include <iostream>    // std::ostream, std::cerr
+#include <cstdlib>     // size_t
+#include <cstdint>     // uintptr_t
+#include <new>         // std::nothrow
+#include <utility>     // std::swap
+
+namespace fsu
+{
+
+  //----------------------------------
+  //     NoIndex
+  //----------------------------------
+
+  class NoIndex
+  {
+  public:
+    class Hook { } ; // no per-link data
+
+    template < class L > static void   Init       (L * , L * ) {}
+    template < class L > static void   LinkedIn   (L * ) {}
+    template < class L > static void   LinkingOut (L * ) {}
+    template < class L > static void   Rebuild    (L * , L * ) {}
+    template < class L > static size_t Rank       (const L * link);
+    template < class L > static L *    Locate     (L * head, size_t rank);
+    template < class L > static bool   Check      (const L * , const L * , std::ostream& ) { return 1; }
+    template < class L > static size_t Bytes      (const L * , const L * ) { return 0; }
+    template < class L , typename T >
+    static L * Find (L * from, L * tail, const T& t);
+    template < class L , typename T >
+    static L * FindBack (L * from, L * head, const T& t);
+  } ;
+
+  //----------------------------------
+  //     SkipIndex
+  //----------------------------------
+
+  class SkipIndex
+  {
+  public:
+    static const size_t maxHeight = 24; // levels above the links; head and tail have all of them
+
+    class Hook
+    {
+      friend class SkipIndex;
+
+      // level l of a tower: neighbours at level l and the number of links to next_
+      struct Level
+      {
+        Hook *  prev_;
+        Hook *  next_;
+        size_t  width_;
+      } ;
+
+      Level *  up_;     // levels 1 .. height_, nullptr when height_ == 0
+      size_t   height_;
+
+    protected:
+      Hook  () : up_(nullptr), height_(0) {}
+      ~Hook () { delete [] up_; }
+      Hook  (const Hook& ) = delete;
+      Hook& operator = (const Hook& ) = delete;
+    } ;
+
+    template < class L > static void   Init       (L * head, L * tail);
+    template < class L > static void   LinkedIn   (L * link);
+    template < class L > static void   LinkingOut (L * link);
+    template < class L > static void   Rebuild    (L * head, L * tail);
+    template < class L > static size_t Rank       (const L * link);
+    template < class L > static L *    Locate     (L * head, size_t rank);
+    template < class L > static bool   Check      (const L * head, const L * tail, std::ostream& os);
+    template < class L > static size_t Bytes      (const L * head, const L * tail);
+    template < class L , typename T >
+    static L * Find (L * from, L * tail, const T& t);
+    template < class L , typename T >
+    static L * FindBack (L * from, L * head, const T& t);
+
+  private:
+    static size_t Height (const void * link); // random tower height, from the address
+    static bool   Build  (Hook * hook, size_t height);
+    static void   Drop   (Hook * hook);
+
+    // the head of the list holding link, and the rank of link
+    template < class L > static Hook * Climb (const L * link, size_t& rank);
+
+    // at each level, the last tower ranked below rank, and its rank
+    static void Descend (Hook * head, size_t rank, Hook ** pred, size_t * predRank);
+  } ;
+
+  //----------------------------------
+  //     HashIndex<H>
+  //----------------------------------
+
+  template < class H >  // H()(t) hashes a value t
+  class HashIndex
+  {
+  public:
+    class Hook
+    {
+      template < class > friend class HashIndex;
+
+      Hook *  chain_;  // next link in the same bucket
+      size_t  hash_;   // hash of Tval_ when the link joined, for unlinking and rehashing
+
+    protected:
+      Hook  () : chain_(nullptr), hash_(0) {}
+    } ;
+
+    HashIndex  ();
+    ~HashIndex ();
+    HashIndex  (HashIndex&& x);              // x is left with no table
+    HashIndex& operator = (HashIndex&& x);   // exchanges tables
+
+    template < class L > void   Init       (L * head, L * tail);
+    template < class L > void   LinkedIn   (L * link);
+    template < class L > void   LinkingOut (L * link);
+    template < class L > void   Rebuild    (L * head, L * tail);
+    template < class L > static size_t Rank (const L * link);
+    template < class L > static L *    Locate (L * head, size_t rank);
+    template < class L > bool   Check      (const L * head, const L * tail, std::ostream& os) const;
+    template < class L > size_t Bytes      (const L * head, const L * tail) const;
+    template < class L , typename T >
+    L * Find (L * from, L * tail, const T& t) const;
+    template < class L , typename T >
+    L * FindBack (L * from, L * head, const T& t) const;
+
+  private:
+    Hook ** bucket_;
+    size_t  buckets_; // a power of 2, or 0 when there is no table and Find walks the links
+    size_t  count_;   // number of links in the table
+    H       hash_;
+
+    bool Resize (size_t buckets); // move the links to a table of the given size
+    void Insert (Hook * hook);
+
+    HashIndex (const HashIndex& ) = delete;
+    HashIndex& operator = (const HashIndex& ) = delete;
+  } ;
+
+#include <linkindex.cpp>
+
+} // namespace fsu
+
+#endif
@@ -0,0 +1,105 @@
+/*
+    linkpool.cpp
+    Andrew J Wood
+
+    slave file to linkpool.h
+
+    Implementation of the fsu::LinkPool<L> slab allocator
+*/
+
+template < class L >
+LinkPool<L>::LinkPool (size_t linksPerBlock)
+  : blocks_(nullptr), free_(nullptr), carve_(nullptr), blockEnd_(nullptr),
+    linksPerBlock_(linksPerBlock == 0 ? 1 : linksPerBlock),
+    numBlocks_(0), inUse_(0), capacity_(0)
+{}
+
+template < class L >
+LinkPool<L>::~LinkPool ()
+// returns every block to the system
+{
+  if (inUse_ != 0)
+  {
+    std::cerr << "** LinkPool error: pool destroyed with " << inUse_ << " links in use\n";
+  }
+  while (blocks_ != nullptr)
+  {
+    Slot * next = blocks_->next_;
+    ::operator delete (blocks_);
+    blocks_ = next;
+  }
+}
+
+template < class L >
+bool LinkPool<L>::NewBlock ()
+// allocate a block of linksPerBlock_ slots plus one slot for the block chain
+{
+  Slot * block = static_cast < Slot* > (::operator new ((linksPerBlock_ + 1) * sizeof(Slot), std::nothrow));
+  if (block == nullptr)
+  {
+    std::cerr << "** LinkPool error: memory allocation failure\n";
+    return 0;
+  }
+  block->next_ = blocks_;
+  blocks_ = block;
+  carve_ = block + 1;
+  blockEnd_ = carve_ + linksPerBlock_;
+  ++numBlocks_;
+  return 1;
+}
+
+template < class L >
+void* LinkPool<L>::Allocate ()
+// recycled slots first, then fresh slots from the current block
+{
+  Slot * slot;
+  if (free_ != nullptr)
+  {
+    slot = free_;
+    free_ = free_->next_;
+  }
+  else
+  {
+    if (carve_ == blockEnd_ && !NewBlock())
+      return nullptr;
+    slot = carve_++;
+    ++capacity_;
+  }
+  ++inUse_;
+  return slot;
+}
+
+template < class L >
+void LinkPool<L>::Deallocate (void* ptr)
+{
+  if (ptr == nullptr)
+    return;
+  Slot * slot = static_cast < Slot* > (ptr);
+  slot->next_ = free_;
+  free_ = slot;
+  --inUse_;
+}
+
+template < class L >
+size_t LinkPool<L>::Blocks () const
+{
+  return numBlocks_;
+}
+
+template < class L >
+size_t LinkPool<L>::InUse () const
+{
+  return inUse_;
+}
+
+template < class L >
+size_t LinkPool<L>::Capacity () const
+{
+  return capacity_;
+}
+
+template < class L >
+size_t LinkPool<L>::LinksPerBlock () const
+{
+  return linksPerBlock_;
+}
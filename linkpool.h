@@ -0,0 +1,71 @@
+/*
+    linkpool.h
+    Andrew J Wood
+
+    Definition of the fsu::LinkPool<L> API
+
+    A slab allocator for the Link objects of a linked container. Storage is
+    carved out of large blocks, one link at a time, and links returned to the
+    pool are kept on a free list for reuse. Blocks are given back to the
+    system only when the pool is destroyed.
+
+    The pool hands out raw storage; the container is responsible for
+    constructing and destroying the link objects (placement new and an
+    explicit destructor call).
+
+    One pool may be shared by several containers, so that links can move
+    between them (Merge, Splice) without leaving the arena. The pool must
+    outlive every container that uses it.
+*/
+
+#ifndef _LINKPOOL_H
+#define _LINKPOOL_H
+
+#include <iostream>    // std::cerr
+#include <cstdlib>     // size_t
+#include <new>         // std::nothrow
+#include <type_traits> // std::aligned_storage
+
+namespace fsu
+{
+
+  template < class L >
+  class LinkPool
+  {
+  public:
+    explicit LinkPool (size_t linksPerBlock = 1024);
+    ~LinkPool ();
+
+    void*  Allocate   ();          // storage for one L, or nullptr on failure
+    void   Deallocate (void* ptr); // return storage obtained from Allocate()
+
+    size_t Blocks        () const; // number of blocks allocated
+    size_t InUse         () const; // number of links currently handed out
+    size_t Capacity      () const; // number of links carved out of blocks so far
+    size_t LinksPerBlock () const; // number of links in each block
+
+  private:
+    // a slot holds either a live link or a pointer to the next free slot
+    union Slot
+    {
+      Slot * next_;
+      typename std::aligned_storage < sizeof(L), alignof(L) >::type data_;
+    };
+
+    Slot * blocks_;   // chain of blocks; slot 0 of each block links to the next block
+    Slot * free_;     // free list of recycled slots
+    Slot * carve_;    // next never-used slot in the current block
+    Slot * blockEnd_; // one past the last slot in the current block
+    size_t linksPerBlock_, numBlocks_, inUse_, capacity_;
+
+    bool NewBlock ();
+
+    LinkPool (const LinkPool&) = delete;
+    LinkPool& operator = (const LinkPool&) = delete;
+  } ;
+
+#include <linkpool.cpp>
+
+} // namespace fsu
+
+#endif
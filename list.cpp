@@ -28,10 +28,12 @@
 
 // stand-alone functions
 
-template < typename T >
-bool operator == (const List<T>& x1, const List<T>& x2)
+template < typename T , class I , class A >
+bool operator == (const List<T,I,A>& x1, const List<T,I,A>& x2)
 {
-  typename List<T>::ConstIterator i1, i2;
+  if (x1.Size() != x2.Size())
+    return 0;
+  typename List<T,I,A>::ConstIterator i1, i2;
   for (
         i1 = x1.Begin(), i2 = x2.Begin();
         (i1 != x1.End()) && (i2 != x2.End());
@@ -46,14 +48,14 @@ bool operator == (const List<T>& x1, const List<T>& x2)
   return 1;
 }
 
-template < typename T >
-bool operator != (const List<T>& x1, const List<T>& x2)
+template < typename T , class I , class A >
+bool operator != (const List<T,I,A>& x1, const List<T,I,A>& x2)
 {
   return !(x1 == x2);
 }
 
-template < typename T >
-std::ostream& operator << (std::ostream& os, const List<T>& x2)
+template < typename T , class I , class A >
+std::ostream& operator << (std::ostream& os, const List<T,I,A>& x2)
 {
   x2.Display(os);
   return os;
@@ -63,15 +65,42 @@ std::ostream& operator << (std::ostream& os, const List<T>& x2)
 
 // memory allocator and other private methods
 
-template < typename T >
-List<T>::Link::Link (const T& Tval) : Tval_(Tval), prev_(nullptr), next_(nullptr)
+template < typename T , class I , class A >
+List<T,I,A>::Link::Link (const T& Tval) : Tval_(Tval), prev_(0), next_(nullptr)
 // Link constructor
 {}
 
-template < typename T >
-typename List<T>::Link* List<T>::NewLink (const T& t)
+template < typename T , class I , class A >
+template < class... Args >
+List<T,I,A>::Link::Link (Args&&... args) : Tval_(std::forward<Args>(args)...), prev_(0), next_(nullptr)
+// Link constructor - builds Tval_ in place from constructor arguments
+{}
+
+template < typename T , class I , class A >
+template < class... Args >
+typename List<T,I,A>::Link* List<T,I,A>::NewLink (Args&&... args)
 {
-  Link * newLink = new(std::nothrow) Link (t);
+  Link * newLink = nullptr;
+  if (pool_ == nullptr)
+  {
+    typedef std::allocator_traits < LinkAllocator > Traits;
+    try
+    {
+      newLink = Traits::allocate(alloc_,1);
+    }
+    catch (const std::bad_alloc&)
+    {
+      newLink = nullptr;
+    }
+    if (newLink != nullptr)
+      newLink = new(newLink) Link (std::forward<Args>(args)...); // Link constructors are private
+  }
+  else
+  {
+    void * storage = pool_->Allocate();
+    if (storage != nullptr)
+      newLink = new(storage) Link (std::forward<Args>(args)...);
+  }
   if (nullptr == newLink)
   { 
     // exception handler
@@ -81,39 +110,101 @@ typename List<T>::Link* List<T>::NewLink (const T& t)
   return newLink;
 }
 
-template < typename T >
-void List<T>::LinkIn(typename List<T>::Link * location, typename List<T>::Link * newLink)
+template < typename T , class I , class A >
+void List<T,I,A>::DeleteLink (Link * oldLink)
+// return oldLink to wherever NewLink got it
+{
+  if (pool_ == nullptr)
+  {
+    typedef std::allocator_traits < LinkAllocator > Traits;
+    oldLink->~Link();
+    Traits::deallocate(alloc_,oldLink,1);
+  }
+  else
+  {
+    oldLink->~Link();
+    pool_->Deallocate(oldLink);
+  }
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::LinkIn(typename List<T,I,A>::Link * location, typename List<T,I,A>::Link * newLink)
 // link newLink into list at (ahead of) location
 {
-  newLink->next_ = location;
-  newLink->prev_ = location->prev_;
-  newLink->next_->prev_ = newLink;
-  newLink->prev_->next_ = newLink;
+  InsertLink(location,newLink,Direction());
+  index_.LinkedIn(newLink);
+  if (sorted_)
+    sorted_ = InOrder(Prev(newLink),newLink) && InOrder(newLink,location);
 }
 
-template < typename T >
-typename List<T>::Link * List<T>::LinkOut(typename List<T>::Link * oldLink)
+template < typename T , class I , class A >
+typename List<T,I,A>::Link * List<T,I,A>::LinkOut(typename List<T,I,A>::Link * oldLink)
 // unlink oldLink from list, return oldLink
 {
-  oldLink->prev_->next_ = oldLink->next_;
-  oldLink->next_->prev_ = oldLink->prev_;
-  oldLink->prev_ = nullptr;
-  oldLink->next_ = nullptr;
-  return oldLink;
+  index_.LinkingOut(oldLink);
+  if (oldLink == finger_)
+    finger_ = nullptr;
+  return EraseLink(oldLink);
 }
 
-template < typename T >
-void List<T>::Init()
+template < typename T , class I , class A >
+void List<T,I,A>::Transfer(typename List<T,I,A>::Link * location, List<T,I,A>& y, typename List<T,I,A>::Link * first, typename List<T,I,A>::Link * last)
+// unlink the non-empty chain [first,last) from y and link it into this list at (ahead of) location;
+// the caller rebuilds the index of both lists [19] and may restore sorted_ [25]
+{
+  TransferLinks(location,Direction(),first,last,y.Direction()); // flips the chain if y runs the other way [23]
+  sorted_ = 0;
+  if (this != &y)
+    y.finger_ = nullptr; // it may have moved
+}
+
+template < typename T , class I , class A >
+typename List<T,I,A>::Link * List<T,I,A>::Find(typename List<T,I,A>::Link * from, const T& t) const
+// search from from toward tail_ in the direction of the list [23]
+{
+  return reversed_ ? index_.FindBack(from,tail_,t) : index_.Find(from,tail_,t);
+}
+
+template < typename T , class I , class A >
+bool List<T,I,A>::InOrder(typename List<T,I,A>::Link * a, typename List<T,I,A>::Link * b) const
+// a and b adjacent, a first; a T without operator < is never known to be in order [25]
+{
+  if (a == head_ || b == tail_)
+    return 1;
+  return fsu::OptionalLess<T>::able && !fsu::OptionalLess<T>::Less(b->Tval_,a->Tval_);
+}
+
+template < typename T , class I , class A >
+template < class P >
+bool List<T,I,A>::Ordered(P& comp) const
+// O(n) check, stopping at the first element out of order
+{
+  Link * curr = Next(head_);
+  if (curr == tail_)
+    return 1;
+  for (Link * next = Next(curr); next != tail_; curr = next, next = Next(next))
+    if (comp(next->Tval_,curr->Tval_))
+      return 0;
+  return 1;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Init()
 // used by constructors
 {
   head_ = NewLink(T());
   tail_ = NewLink(T());
   head_->next_ = tail_;
   tail_->prev_ = head_;
+  size_ = 0;
+  reversed_ = 0;
+  sorted_ = 1;
+  finger_ = nullptr;
+  index_.Init(head_,tail_);
 }
 
-template < typename T >
-void List<T>::Append(const List<T>& list)
+template < typename T , class I , class A >
+void List<T,I,A>::Append(const List<T,I,A>& list)
 // Appends deep copy of rhs - do not apply to self!
 {
   for (ConstIterator i = list.Begin(); i != list.End(); ++i)
@@ -124,44 +215,101 @@ void List<T>::Append(const List<T>& list)
 
 // constructors and assignment
 
-template < typename T >
-List<T>::List ()  :  head_(nullptr), tail_(nullptr)
+template < typename T , class I , class A >
+List<T,I,A>::List ()  :  head_(nullptr), tail_(nullptr), size_(0), reversed_(0), sorted_(1), finger_(nullptr), pool_(nullptr), alloc_()
 // default constructor
 {
   Init();
 }
 
-template < typename T >
-List<T>::List (const List<T>& x) : head_(nullptr), tail_(nullptr)
-// copy constructor
+template < typename T , class I , class A >
+List<T,I,A>::List (Pool& pool)  :  head_(nullptr), tail_(nullptr), size_(0), reversed_(0), sorted_(1), finger_(nullptr), pool_(&pool), alloc_()
+// links come from (and go back to) pool
+{
+  Init();
+}
+
+template < typename T , class I , class A >
+List<T,I,A>::List (const A& alloc)  :  head_(nullptr), tail_(nullptr), size_(0), reversed_(0), sorted_(1), finger_(nullptr), pool_(nullptr), alloc_(alloc)
+// links come from (and go back to) a copy of alloc [21]
+{
+  Init();
+}
+
+template < typename T , class I , class A >
+List<T,I,A>::List (Pool * pool, const LinkAllocator& alloc)  :  head_(nullptr), tail_(nullptr), size_(0), reversed_(0), sorted_(1), finger_(nullptr), pool_(pool), alloc_(alloc)
+// an empty list allocating as another list does
+{
+  Init();
+}
+
+template < typename T , class I , class A >
+List<T,I,A>::List (const List<T,I,A>& x) : head_(nullptr), tail_(nullptr), size_(0), reversed_(0), sorted_(1), finger_(nullptr), pool_(x.pool_), alloc_(x.alloc_)
+// copy constructor - the copy shares the pool or allocator of x
 {
   Init();
   Append(x);
 }
 
-template < typename T >
-List<T>::~List ()
+template < typename T , class I , class A >
+List<T,I,A>::List (List<T,I,A>&& x) : head_(x.head_), tail_(x.tail_), size_(x.size_), reversed_(x.reversed_), sorted_(x.sorted_), finger_(x.finger_), pool_(x.pool_), index_(std::move(x.index_)), alloc_(x.alloc_)
+// move constructor - takes the links of x and leaves x empty
+{
+  x.Init();
+}
+
+template < typename T , class I , class A >
+List<T,I,A>::~List ()
 // destructor
 {
   Release();
 } 
 
-template < typename T >
-List<T>& List<T>::operator = (const List<T>& rhs)
-// assignment operator
+template < typename T , class I , class A >
+List<T,I,A>& List<T,I,A>::operator = (const List<T,I,A>& rhs)
+// assignment operator - existing links are reused, so only the difference
+// in length is allocated or deleted
 {
   if (this != &rhs)   // it would be a disaster to assign to self!
   {
-    // First, destroy the existing list.
-    Clear();
-    // then build a copy as *this
-    Append(rhs);
+    // First, overwrite the elements already on the list.
+    Link * curr = Next(head_);
+    Link * from = rhs.Next(rhs.head_);
+    for ( ; curr != tail_ && from != rhs.tail_; curr = Next(curr), from = rhs.Next(from))
+      curr->Tval_ = from->Tval_;
+    // then delete the surplus links, or append copies of the rest of rhs
+    while (curr != tail_)
+    {
+      curr = Next(curr);
+      DeleteLink(LinkOut(Prev(curr)));
+      --size_;
+    }
+    for ( ; from != rhs.tail_; from = rhs.Next(from))
+      PushBack(from->Tval_);
+    index_.Rebuild(First(),Last()); // the overwritten values [20]
+    sorted_ = rhs.sorted_;          // and the pushes could not see them [25]
   }
   return *this;
 }
 
-template < typename T >
-List<T>& List<T>::operator += (const List<T>& list)
+template < typename T , class I , class A >
+List<T,I,A>& List<T,I,A>::operator = (List<T,I,A>&& rhs)
+// move assignment - exchanges links with rhs, which takes the old elements
+{
+  std::swap(head_,rhs.head_);
+  std::swap(tail_,rhs.tail_);
+  std::swap(size_,rhs.size_);
+  std::swap(reversed_,rhs.reversed_);
+  std::swap(sorted_,rhs.sorted_);
+  std::swap(finger_,rhs.finger_);
+  std::swap(pool_,rhs.pool_);
+  std::swap(alloc_,rhs.alloc_);
+  std::swap(index_,rhs.index_);
+  return *this;
+}
+
+template < typename T , class I , class A >
+List<T,I,A>& List<T,I,A>::operator += (const List<T,I,A>& list)
 // append operator
 {
   if (this != &list)
@@ -169,28 +317,30 @@ List<T>& List<T>::operator += (const List<T>& list)
   return *this;
 }
 
-template < typename T >
-bool List<T>::PushFront (const T& t)
+template < typename T , class I , class A >
+bool List<T,I,A>::PushFront (const T& t)
 // Insert t at the front (first) position.
 {
   Link* newLink = NewLink(t);
   if (newLink == nullptr) return 0;
-  LinkIn(head_->next_,newLink);
+  LinkIn(Next(head_),newLink);
+  ++size_;
   return 1;
 }
 
-template < typename T >
-bool List<T>::PushBack (const T& t)
+template < typename T , class I , class A >
+bool List<T,I,A>::PushBack (const T& t)
 // Insert t at the back (last) position.
 {
   Link* newLink = NewLink(t);
   if (newLink == nullptr) return 0;
   LinkIn(tail_,newLink);
+  ++size_;
   return 1;
 }
 
-template < typename T >
-ListIterator<T> List<T>::Insert (ListIterator<T> i, const T& t)
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::Insert (ListIterator<T,I,A> i, const T& t)
 // Insert t at (in front of) i; return i at new element
 {
   if (Empty())  // always insert 
@@ -205,13 +355,15 @@ ListIterator<T> List<T>::Insert (ListIterator<T> i, const T& t)
   Link* newLink = NewLink(t);
   if (newLink == nullptr) return End();
   LinkIn(i.curr_,newLink);
+  ++size_;
   // leave i at new entry and return
   i.curr_ = newLink;
+  i.rev_ = reversed_;
   return i;
 }
 
-template < typename T >
-ConstListIterator<T> List<T>::Insert (ConstListIterator<T> i, const T& t)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A> List<T,I,A>::Insert (ConstListIterator<T,I,A> i, const T& t)
 // Insert t at (in front of) i; return i at new element
 {
   if (Empty())  // always insert 
@@ -226,46 +378,195 @@ ConstListIterator<T> List<T>::Insert (ConstListIterator<T> i, const T& t)
   Link* newLink = NewLink(t);
   if (newLink == nullptr) return End();
   LinkIn(i.curr_,newLink);
+  ++size_;
   // leave i at new entry and return
   i.curr_ = newLink;
+  i.rev_ = reversed_;
   return i;
 }
 
-template < typename T >
-ListIterator<T> List<T>::Insert  (const T& t)
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::Insert  (const T& t)
 // Insert t at default location (back)
 {
   return Insert(End(),t);
 }
 
-template < typename T >
-bool List<T>::PopFront()
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::InsertSorted (const T& t)
+{
+  fsu::LessThan<T> p;
+  return InsertSorted(t,p);
+}
+
+template < typename T , class I , class A >
+template < class P >
+ListIterator<T,I,A> List<T,I,A>::InsertSorted (const T& t, P& p)
+// galloping search from finger_, or from the back: steps of 1, 2, 4, ... links
+// bracket the place for t, then a binary search inside the bracket finds it,
+// so O(log d) comparisons for a place d links from the start [25]
+{
+  Link * newLink = NewLink(t);
+  if (newLink == nullptr) return End();
+  Link * lo, * hi; // t goes after lo and before hi
+  size_t n = 0;    // links strictly between lo and hi
+  Link * start = (finger_ != nullptr) ? finger_ : Prev(tail_);
+  if (start == head_) // empty list
+  {
+    lo = head_;
+    hi = tail_;
+  }
+  else if (p(t,start->Tval_)) // gallop toward the front
+  {
+    hi = start;
+    for (size_t step = 1; ; step *= 2)
+    {
+      size_t k = 0;
+      for (lo = hi; k < step && lo != head_; ++k)
+        lo = Prev(lo);
+      if (lo == head_ || !p(t,lo->Tval_))
+      {
+        n = k - 1;
+        break;
+      }
+      hi = lo;
+    }
+  }
+  else // gallop toward the back
+  {
+    lo = start;
+    for (size_t step = 1; ; step *= 2)
+    {
+      size_t k = 0;
+      for (hi = lo; k < step && hi != tail_; ++k)
+        hi = Next(hi);
+      if (hi == tail_ || p(t,hi->Tval_))
+      {
+        n = k - 1;
+        break;
+      }
+      lo = hi;
+    }
+  }
+  while (n > 0) // binary search of the bracket
+  {
+    size_t half = n / 2;
+    Link * mid = Next(lo);
+    for (size_t k = 0; k < half; ++k)
+      mid = Next(mid);
+    if (p(t,mid->Tval_))
+    {
+      hi = mid;
+      n = half;
+    }
+    else
+    {
+      lo = mid;
+      n -= half + 1;
+    }
+  }
+  LinkIn(hi,newLink);
+  ++size_;
+  finger_ = newLink;
+  return Iterator(newLink,reversed_);
+}
+
+template < typename T , class I , class A >
+bool List<T,I,A>::PushFront (T&& t)
+{
+  return EmplaceFront(std::move(t));
+}
+
+template < typename T , class I , class A >
+bool List<T,I,A>::PushBack (T&& t)
+{
+  return EmplaceBack(std::move(t));
+}
+
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::Insert (ListIterator<T,I,A> i, T&& t)
+{
+  return Emplace(i,std::move(t));
+}
+
+template < typename T , class I , class A >
+template < class... Args >
+bool List<T,I,A>::EmplaceFront (Args&&... args)
+// Construct a new element at the front (first) position.
+{
+  Link* newLink = NewLink(std::forward<Args>(args)...);
+  if (newLink == nullptr) return 0;
+  LinkIn(Next(head_),newLink);
+  ++size_;
+  return 1;
+}
+
+template < typename T , class I , class A >
+template < class... Args >
+bool List<T,I,A>::EmplaceBack (Args&&... args)
+// Construct a new element at the back (last) position.
+{
+  Link* newLink = NewLink(std::forward<Args>(args)...);
+  if (newLink == nullptr) return 0;
+  LinkIn(tail_,newLink);
+  ++size_;
+  return 1;
+}
+
+template < typename T , class I , class A >
+template < class... Args >
+ListIterator<T,I,A> List<T,I,A>::Emplace (ListIterator<T,I,A> i, Args&&... args)
+// Construct a new element at (in front of) i; return i at new element
+{
+  if (Empty())  // always insert 
+  {
+    i = End();
+  }
+  if (!i.Valid() || i == rEnd()) // null or off-the-front
+  {
+    std::cerr << " ** cannot insert at position -1\n";
+    return End();
+  }
+  Link* newLink = NewLink(std::forward<Args>(args)...);
+  if (newLink == nullptr) return End();
+  LinkIn(i.curr_,newLink);
+  ++size_;
+  // leave i at new entry and return
+  i.curr_ = newLink;
+  i.rev_ = reversed_;
+  return i;
+}
+
+template < typename T , class I , class A >
+bool List<T,I,A>::PopFront()
 {
   if (Empty())
   {
     std::cerr << "** List error: PopFront() called on empty list\n"; 
     return 0;
   }
-  Link * oldLink = LinkOut(head_->next_);
-  delete oldLink;
+  Link * oldLink = LinkOut(Next(head_));
+  DeleteLink(oldLink);
+  --size_;
   return 1;
 } // end PopFront()
 
-template < typename T >
-bool List<T>::PopBack()
+template < typename T , class I , class A >
+bool List<T,I,A>::PopBack()
 {
   if (Empty())
   {
     std::cerr << "** List error: PopBack() called on empty list\n"; 
     return 0;
   }
-  Link* oldLink = LinkOut(tail_->prev_);
-  delete oldLink;
+  Link* oldLink = LinkOut(Prev(tail_));
+  DeleteLink(oldLink);
+  --size_;
   return 1;
 } // end PopBack()
 
-template < typename T >
-ListIterator<T> List<T>::Remove (Iterator i)
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::Remove (Iterator i)
 // Remove item at i
 {
   // first deal with the impossible cases
@@ -274,14 +575,16 @@ ListIterator<T> List<T>::Remove (Iterator i)
     std::cerr << "** List error: Remove(i) called with vacuous iterator\n"; 
     return i;
   }
-  i.curr_ = i.curr_->next_;                  // advance iterator
-  Link * oldLink = LinkOut(i.curr_->prev_);  // unlink element to be removed
-  delete oldLink;                            // delete 
+  i.curr_ = Next(i.curr_);                   // advance iterator
+  i.rev_ = reversed_;
+  Link * oldLink = LinkOut(Prev(i.curr_));   // unlink element to be removed
+  DeleteLink(oldLink);                       // delete 
+  --size_;
   return i;                                  // return i at new position
 } // end Remove(Iterator)
 
-template < typename T >
-ConstListIterator<T> List<T>::Remove (ConstIterator i)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A> List<T,I,A>::Remove (ConstIterator i)
 // Remove item at i
 {
   // first deal with the impossible cases
@@ -290,82 +593,102 @@ ConstListIterator<T> List<T>::Remove (ConstIterator i)
     std::cerr << "** List error: Remove(i) called with vacuous iterator\n"; 
     return i;
   }
-  i.curr_ = i.curr_->next_;                  // advance iterator
-  Link * oldLink = LinkOut(i.curr_->prev_);  // unlink element to be removed
-  delete oldLink;                            // delete 
+  i.curr_ = Next(i.curr_);                   // advance iterator
+  i.rev_ = reversed_;
+  Link * oldLink = LinkOut(Prev(i.curr_));   // unlink element to be removed
+  DeleteLink(oldLink);                       // delete 
+  --size_;
   return i;                                  // return i at new position
 } // end Remove(Iterator)
 
-template < typename T >
-size_t  List<T>::Remove (const T& t)
+template < typename T , class I , class A >
+size_t  List<T,I,A>::Remove (const T& t)
 // Remove all copies of t
 // This doesn't use member priviledge, so could be an external function
 // It gives the archetype for interaction between Remove(i) and ++i
 {
   size_t count(0);
-  Iterator i = Begin();
-  while (i != End())
+  Link * link = Find(Next(head_),t);
+  while (link != tail_)
   {
-    if (t == *i)
-    {
-      i = Remove(i);
-      ++count;
-    }
-    else
-    {
-      ++i;
-    }
+    Iterator i = Remove(Iterator(link,reversed_));
+    ++count;
+    link = Find(i.curr_,t); // the next copy, or any copy left [20]
   }
   return (count);
 }  // end Remove(t)
 
-template < typename T >
-void List<T>::Clear()
+template < typename T , class I , class A >
+void List<T,I,A>::Clear()
 // Makes list empty
 {
   while (!Empty())
     PopFront();
+  sorted_ = 1;
 } // end Clear()
 
-template < typename T >
-void List<T>::Release()
+template < typename T , class I , class A >
+void List<T,I,A>::Release()
 // Deletes all links 
 {
   Clear();
-  delete head_;
-  delete tail_;
+  DeleteLink(head_);
+  DeleteLink(tail_);
 } // end Clear()
 
-template < typename T >
-List<T> * List<T>::Clone() const
+template < typename T , class I , class A >
+List<T,I,A> * List<T,I,A>::Clone() const
 // returns pointer to a copy of *this
 {
-  List * clone = new List;
+  List * clone = new List(pool_,alloc_);
   clone->Append(*this);
   return clone;
 } 
 
-template < typename T >
-size_t List<T>::Size()  const
+template < typename T , class I , class A >
+size_t List<T,I,A>::Size()  const
+// size_ is maintained by the mutators
 {
-  size_t  size(0);
-  Link * curr(head_->next_);
-  while (curr != tail_)
-  {
-    curr = curr -> next_;
-    ++size;
-  }
-  return size;
+  return size_;
 }
 
-template < typename T >
-bool List<T>::Empty()  const
+template < typename T , class I , class A >
+bool List<T,I,A>::Empty()  const
 {
-  return (head_->next_ == tail_);
+  return (Next(head_) == tail_);
 }
 
-template < typename T >
-T& List<T>::Front ()
+template < typename T , class I , class A >
+bool List<T,I,A>::Sorted()  const
+// a hint: values changed through iterators, Front, Back or At are not seen [25]
+{
+  return sorted_;
+}
+
+template < typename T , class I , class A >
+ListStats List<T,I,A>::Stats() const
+{
+  ListStats s;
+  s.elements    = size_;
+  s.links       = size_;
+  s.sentinels   = 2;
+  s.linkBytes   = (s.links + s.sentinels) * sizeof(Link);
+  s.objectBytes = sizeof(*this);
+  s.indexBytes  = index_.Bytes(First(),Last());
+  if (PayloadBytes<T>::deep)
+    for (Link * link = Next(head_); link != tail_; link = Next(link))
+      s.payloadBytes += PayloadBytes<T>::Bytes(link->Tval_);
+  return s;
+}
+
+template < typename T , class I , class A >
+size_t List<T,I,A>::MemoryUsage() const
+{
+  return Stats().Bytes();
+}
+
+template < typename T , class I , class A >
+T& List<T,I,A>::Front ()
 {
   if (Empty())
   {
@@ -374,8 +697,8 @@ T& List<T>::Front ()
   return *Begin();
 }
 
-template < typename T >
-const T& List<T>::Front () const
+template < typename T , class I , class A >
+const T& List<T,I,A>::Front () const
 {
   if (Empty())
   {
@@ -384,8 +707,8 @@ const T& List<T>::Front () const
   return *Begin();
 }
 
-template < typename T >
-T& List<T>::Back  ()
+template < typename T , class I , class A >
+T& List<T,I,A>::Back  ()
 {
   if (Empty())
   {
@@ -394,8 +717,8 @@ T& List<T>::Back  ()
   return *rBegin();
 }
 
-template < typename T >
-const T& List<T>::Back  () const
+template < typename T , class I , class A >
+const T& List<T,I,A>::Back  () const
 {
   if (Empty())
   {
@@ -404,23 +727,87 @@ const T& List<T>::Back  () const
   return *rBegin();
 }
 
-template <typename T> 
-ListIterator<T>  List<T>::Includes (const T& t)
-// sequential search
+// positional access [19]
+
+template < typename T , class I , class A >
+T& List<T,I,A>::At (size_t k)
+{
+  if (k >= size_)
+  {
+      std::cerr << "** List error: At() called with index out of range\n"; 
+  }
+  return *IteratorAt(k);
+}
+
+template < typename T , class I , class A >
+const T& List<T,I,A>::At (size_t k) const
+{
+  if (k >= size_)
+  {
+      std::cerr << "** List error: At() called with index out of range\n"; 
+  }
+  return *IteratorAt(k);
+}
+
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::IteratorAt (size_t k)
+// element k has rank k + 1, counting head_ as rank 0; ranks are counted from
+// First(), so a reversed list finds element k at rank size_ - k [23]
+{
+  if (k >= size_)
+    return End();
+  return Iterator(index_.Locate(First(),reversed_ ? size_ - k : k + 1),reversed_);
+}
+
+template < typename T , class I , class A >
+typename List<T,I,A>::ConstIterator List<T,I,A>::IteratorAt (size_t k) const
+{
+  if (k >= size_)
+    return End();
+  return ConstIterator(index_.Locate(First(),reversed_ ? size_ - k : k + 1),reversed_);
+}
+
+template < typename T , class I , class A >
+size_t List<T,I,A>::IndexOf (ConstIterator i) const
 {
-  Iterator i;
-  for (i = Begin(); i != End(); ++i)
+  if (i.curr_ == nullptr || i.curr_ == head_)
   {
-    if (t == *i)
-      return i;
+    std::cerr << "** List error: IndexOf() called with vacuous iterator\n"; 
+    return size_;
   }
-  return End();
+  size_t rank = index_.Rank(i.curr_);
+  return reversed_ ? size_ - rank : rank - 1;
+}
+
+template < typename T , class I , class A >
+ListIterator<T,I,A> List<T,I,A>::Advance (Iterator i, long n)
+// rEnd() and End() are ranks 0 and size_ + 1; any other destination gives End()
+{
+  if (i.curr_ == nullptr)
+  {
+    std::cerr << "** List error: Advance() called with vacuous iterator\n"; 
+    return End();
+  }
+  size_t rank = index_.Rank(i.curr_);
+  if (reversed_)
+    rank = size_ + 1 - rank;
+  if (n < 0 ? rank < size_t(-n) : size_ + 1 - rank < size_t(n))
+    return End();
+  rank += n;
+  return Iterator(index_.Locate(First(),reversed_ ? size_ + 1 - rank : rank),reversed_);
+}
+
+template < typename T , class I , class A > 
+ListIterator<T,I,A>  List<T,I,A>::Includes (const T& t)
+// sequential search, or a lookup in the index [20]
+{
+  return Iterator(Find(Next(head_),t),reversed_);
 } // Includes()
 
 // output methods
 
-template < typename T >
-void List<T>::Display (std::ostream& os, char ofc) const
+template < typename T , class I , class A >
+void List<T,I,A>::Display (std::ostream& os, char ofc) const
 {
   ConstIterator i;
   if (ofc == '\0')
@@ -433,17 +820,17 @@ void List<T>::Display (std::ostream& os, char ofc) const
 
 // debug/developer methods
 
-template < typename T >
-void List<T>::Dump (std::ostream& os, char ofc) const
+template < typename T , class I , class A >
+void List<T,I,A>::Dump (std::ostream& os, char ofc) const
 {
   Display(os,ofc);
   os << '\n';
 } // Dump()
 
-template < typename T >
-void List<T>::CheckLinks(std::ostream& os) const
+template < typename T , class I , class A >
+void List<T,I,A>::CheckLinks(std::ostream& os) const
 {
-  typename List<T>::ConstIterator i,j,k;
+  typename List<T,I,A>::ConstIterator i,j,k;
   // bool ok = 1;
   size_t n = 0;
   for (i = this->Begin(), n = 0; i != this->End(); ++i, ++n)
@@ -458,6 +845,10 @@ void List<T>::CheckLinks(std::ostream& os) const
     }
   }
   // if (ok) os << " ** passed forward reciprocity check\n";
+  if (i == this->End() && n != Size())
+  {
+    os << " ** Size() mismatch: count = " << n << " , size = " << Size() << '\n';
+  }
   
   for (i = this->rBegin(), n = Size(); i != this->rEnd(); --i, --n)
   {
@@ -470,79 +861,74 @@ void List<T>::CheckLinks(std::ostream& os) const
       break;
     }
   }     
+  index_.Check(First(),Last(),os);
   // if (ok) os << " ** passed reverse reciprocity check\n";
 } // CheckLinks()
 
 // Iterator support
 
-template < typename T >
-ListIterator<T>  List<T>::Begin()
+template < typename T , class I , class A >
+ListIterator<T,I,A>  List<T,I,A>::Begin()
 {
-  Iterator i(head_->next_);
+  Iterator i(Next(head_),reversed_);
   return i;
 }
 
-template < typename T >
-ListIterator<T>  List<T>::End()
+template < typename T , class I , class A >
+ListIterator<T,I,A>  List<T,I,A>::End()
 {
-  Iterator i(tail_);
+  Iterator i(tail_,reversed_);
   return i;
 }
 
-template < typename T >
-ListIterator<T>  List<T>::rBegin()
+template < typename T , class I , class A >
+ListIterator<T,I,A>  List<T,I,A>::rBegin()
 {
-  Iterator i(tail_->prev_);
+  Iterator i(Prev(tail_),reversed_);
   return i;
 }
 
-template < typename T >
-ListIterator<T>  List<T>::rEnd ()
+template < typename T , class I , class A >
+ListIterator<T,I,A>  List<T,I,A>::rEnd ()
 {
-  Iterator i(head_);
+  Iterator i(head_,reversed_);
   return i;
 }
 
 // ConstIterator support
 
-template < typename T >
-typename List<T>::ConstIterator  List<T>::Begin() const
+template < typename T , class I , class A >
+typename List<T,I,A>::ConstIterator  List<T,I,A>::Begin() const
 {
-  ConstIterator i(head_->next_);
+  ConstIterator i(Next(head_),reversed_);
   return i;
 }
 
-template < typename T >
-typename List<T>::ConstIterator  List<T>::End() const
+template < typename T , class I , class A >
+typename List<T,I,A>::ConstIterator  List<T,I,A>::End() const
 {
-  ConstIterator i(tail_);
+  ConstIterator i(tail_,reversed_);
   return i;
 }
 
-template < typename T >
-typename List<T>::ConstIterator  List<T>::rBegin() const
+template < typename T , class I , class A >
+typename List<T,I,A>::ConstIterator  List<T,I,A>::rBegin() const
 {
-  ConstIterator i(tail_->prev_);
+  ConstIterator i(Prev(tail_),reversed_);
   return i;
 }
 
-template < typename T >
-typename List<T>::ConstIterator  List<T>::rEnd () const
+template < typename T , class I , class A >
+typename List<T,I,A>::ConstIterator  List<T,I,A>::rEnd () const
 {
-  ConstIterator i(head_);
+  ConstIterator i(head_,reversed_);
   return i;
 }
 
-template <typename T> 
-typename List<T>::ConstIterator  List<T>::Includes (const T& t) const
+template < typename T , class I , class A > 
+typename List<T,I,A>::ConstIterator  List<T,I,A>::Includes (const T& t) const
 {
-  ConstIterator i;
-  for (i = Begin(); i != End(); ++i)
-  {
-    if (t == *i)
-      return i;
-  }
-  return End();
+  return ConstIterator(Find(Next(head_),t),reversed_);
 } // Includes()
 
 //-------------------------------------------
@@ -550,34 +936,35 @@ typename List<T>::ConstIterator  List<T>::Includes (const T& t) const
 //-------------------------------------------
 
 // default constructor
-template < typename T >
-ConstListIterator<T>::ConstListIterator ()  :  curr_(nullptr)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>::ConstListIterator ()  :  curr_(nullptr), rev_(0)
 // construct a null ConstListIterator 
 {}
 
 // protected constructor
-template < typename T >
-ConstListIterator<T>::ConstListIterator (typename List<T>::Link* link) : curr_(link)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>::ConstListIterator (typename List<T,I,A>::Link* link, bool rev) : curr_(link), rev_(rev)
 // construct an iterator around a link pointer (not available to client programs)
 {}
 
 // copy constructor
-template < typename T >
-ConstListIterator<T>::ConstListIterator (const ConstListIterator<T>& i)
-   :  curr_(i.curr_)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>::ConstListIterator (const ConstListIterator<T,I,A>& i)
+   :  curr_(i.curr_), rev_(i.rev_)
 {}
 
 // assignment operator
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator = (const ConstListIterator <T> & i)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>& ConstListIterator<T,I,A>::operator = (const ConstListIterator <T,I,A> & i)
 {
    curr_ = i.curr_;
+   rev_ = i.rev_;
    return *this;
 }
 
 // protected method
-template < typename T >
-T&  ConstListIterator<T>::Retrieve() const
+template < typename T , class I , class A >
+T&  ConstListIterator<T,I,A>::Retrieve() const
 // Return reference to current t
 // note conflicted signature - const method returns non-const reference
 {
@@ -589,65 +976,65 @@ T&  ConstListIterator<T>::Retrieve() const
   return curr_->Tval_;
 }
 
-template < typename T >
-bool ConstListIterator<T>::Valid() const
+template < typename T , class I , class A >
+bool ConstListIterator<T,I,A>::Valid() const
 // test cursor for legal dereference
 {
   return curr_ != nullptr;
 }
 
-template < typename T >
-bool ConstListIterator<T>::operator == (const ConstListIterator<T>& i2) const
+template < typename T , class I , class A >
+bool ConstListIterator<T,I,A>::operator == (const ConstListIterator<T,I,A>& i2) const
 {
   if (curr_ == i2.curr_)
     return 1;
   return 0;
 }
 
-template < typename T >
-bool ConstListIterator<T>::operator != (const ConstListIterator<T>& i2) const
+template < typename T , class I , class A >
+bool ConstListIterator<T,I,A>::operator != (const ConstListIterator<T,I,A>& i2) const
 {
   return !(*this == i2);
 }
 
-template < typename T >
-const T&  ConstListIterator<T>::operator * () const
+template < typename T , class I , class A >
+const T&  ConstListIterator<T,I,A>::operator * () const
 {
   return Retrieve();
 }
 
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator ++ ()
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>& ConstListIterator<T,I,A>::operator ++ ()
 // prefix increment
 {
   if (curr_ != nullptr)
-    curr_ = curr_->next_;
+    curr_ = rev_ ? curr_->prev_ : curr_->next_;
   return *this;
 }
 
-template < typename T >
-ConstListIterator<T> ConstListIterator<T>::operator ++ (int)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A> ConstListIterator<T,I,A>::operator ++ (int)
 // postfix increment
 {
-   ConstListIterator <T> clone = *this;
+   ConstListIterator <T,I,A> clone = *this;
    this->operator++();
    return clone;
 }
 
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator -- ()
+template < typename T , class I , class A >
+ConstListIterator<T,I,A>& ConstListIterator<T,I,A>::operator -- ()
 // prefix decrement
 {
   if (curr_ != nullptr)
-    curr_ = curr_->prev_;
+    curr_ = rev_ ? curr_->next_ : curr_->prev_;
   return *this;
 }
 
-template < typename T >
-ConstListIterator<T> ConstListIterator<T>::operator -- (int)
+template < typename T , class I , class A >
+ConstListIterator<T,I,A> ConstListIterator<T,I,A>::operator -- (int)
 // postfix decrement
 {
-   ConstListIterator <T> clone = *this;
+   ConstListIterator <T,I,A> clone = *this;
    this->operator--();
    return clone;
 }
@@ -657,73 +1044,73 @@ ConstListIterator<T> ConstListIterator<T>::operator -- (int)
 //-------------------------------------------
 
 // default constructor
-template < typename T >
-ListIterator<T>::ListIterator ()  :  ConstListIterator<T>()
+template < typename T , class I , class A >
+ListIterator<T,I,A>::ListIterator ()  :  ConstListIterator<T,I,A>()
 // construct a null ListIterator 
 {}
 
 // protected constructor
-template < typename T >
-ListIterator<T>::ListIterator (typename List<T>::Link* link) : ConstListIterator<T>(link)
+template < typename T , class I , class A >
+ListIterator<T,I,A>::ListIterator (typename List<T,I,A>::Link* link, bool rev) : ConstListIterator<T,I,A>(link,rev)
 // construct an iterator around a link pointer (not available to client programs)
 {}
 
 // copy constructor
-template < typename T >
-ListIterator<T>::ListIterator (const ListIterator<T>& i)
-   :  ConstListIterator<T>(i)
+template < typename T , class I , class A >
+ListIterator<T,I,A>::ListIterator (const ListIterator<T,I,A>& i)
+   :  ConstListIterator<T,I,A>(i)
 {}
 
 // assignment operator
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator = (const ListIterator <T> & i)
+template < typename T , class I , class A >
+ListIterator<T,I,A>& ListIterator<T,I,A>::operator = (const ListIterator <T,I,A> & i)
 {
-  ConstListIterator<T>::operator=(i);
+  ConstListIterator<T,I,A>::operator=(i);
   return *this;
 }
 
-template < typename T >
-const T&  ListIterator<T>::operator * () const
+template < typename T , class I , class A >
+const T&  ListIterator<T,I,A>::operator * () const
 {
-  return ConstListIterator<T>::Retrieve();
+  return ConstListIterator<T,I,A>::Retrieve();
 }
 
-template < typename T >
-T&  ListIterator<T>::operator * ()
+template < typename T , class I , class A >
+T&  ListIterator<T,I,A>::operator * ()
 {
-  return ConstListIterator<T>::Retrieve();
+  return ConstListIterator<T,I,A>::Retrieve();
 }
 
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator ++ ()
+template < typename T , class I , class A >
+ListIterator<T,I,A>& ListIterator<T,I,A>::operator ++ ()
 // prefix increment
 {
-  ConstListIterator<T>::operator++();
+  ConstListIterator<T,I,A>::operator++();
   return *this;
 }
 
-template < typename T >
-ListIterator<T> ListIterator<T>::operator ++ (int)
+template < typename T , class I , class A >
+ListIterator<T,I,A> ListIterator<T,I,A>::operator ++ (int)
 // postfix increment
 {
-   ListIterator <T> clone = *this;
+   ListIterator <T,I,A> clone = *this;
    this->operator++();
    return clone;
 }
 
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator -- ()
+template < typename T , class I , class A >
+ListIterator<T,I,A>& ListIterator<T,I,A>::operator -- ()
 // prefix decrement
 {
-  ConstListIterator<T>::operator--();
+  ConstListIterator<T,I,A>::operator--();
   return *this;
 }
 
-template < typename T >
-ListIterator<T> ListIterator<T>::operator -- (int)
+template < typename T , class I , class A >
+ListIterator<T,I,A> ListIterator<T,I,A>::operator -- (int)
 // postfix decrement
 {
-   ListIterator <T> clone = *this;
+   ListIterator <T,I,A> clone = *this;
    this->operator--();
    return clone;
 }
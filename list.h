@@ -3,7 +3,7 @@
     12/08/16
     Chris Lacher
 
-    Definition the fsu::List<T> API
+    Definition the fsu::List<T,I,A> API
 
     This version has bool return type for push and pop operations
     (a little slower due to redundant check for allocation failure)
@@ -18,40 +18,70 @@
 
 #include <iostream>    // class ostream and objects cerr, cout
 #include <cstdlib>     // EXIT_FAILURE, size_t
+#include <utility>     // std::move, std::forward, std::swap
 #include <compare.h>   // needed for Sort()
+#include <memory>      // std::allocator, std::allocator_traits
+#include <linkpool.h>  // optional shared link allocator
+#include <linkindex.h> // index policies NoIndex, SkipIndex, HashIndex
+#include <liststats.h> // ListStats, PayloadBytes
+#include <functional>  // std::hash, default for IndexedList
+#include <thread>      // parallel Sort(p,threads)
+#include <system_error> // thread start failure
+#include <type_traits> // std::is_same, for the sorted state
+#include <xran.h>      // fsu::RandomBase, for Shuffle(ran)
+
+#ifndef LIST_SORT_MIN_RUN
+#define LIST_SORT_MIN_RUN 32768  // fewest elements per run in parallel Sort [18]
+#endif
 
 namespace fsu
 {
 
-  template < typename T >
+  template < typename T , class I = NoIndex , class A = std::allocator<T> >
   class List;
 
-  template < typename T >
+  template < typename T , class I = NoIndex , class A = std::allocator<T> >
   class ConstListIterator;
 
-  template < typename T >
+  template < typename T , class I = NoIndex , class A = std::allocator<T> >
   class ListIterator;
 
+  template < class L >
+  class LinkDirection; // list_link.cpp
+
+  // List with O(1) expected Includes and Remove(t) [20]
+  template < typename T , class H = std::hash<T> >
+  using IndexedList = List < T , HashIndex < H > > ;
+
   //----------------------------------
   //     List<T>
   //----------------------------------
 
-  template < typename T >
+  template < typename T , class I , class A >
   class List
   {
+  protected:
+    class Link; // defined below
+    typedef typename std::allocator_traits < A > ::template rebind_alloc < Link > LinkAllocator; // [21]
 
   public:
     // terminology support: 
     // some scope List<T>:: type definitions to facilitate clients
     typedef T                                      ValueType;
-    typedef ListIterator < T >                     Iterator;
-    typedef ConstListIterator < T >                ConstIterator;
+    typedef ListIterator < T , I , A >             Iterator;
+    typedef ConstListIterator < T , I , A >        ConstIterator;
+    typedef LinkPool < Link >                      Pool;  // [15]
+    typedef A                                      AllocatorType; // [21]
 
     // constructors and assignment
                    List       ();              // default constructor
+    explicit       List       (Pool& pool);    // links allocated from a shared pool [15]
+    explicit       List       (const A& alloc); // links allocated by a copy of alloc [21]
     virtual        ~List      ();              // destructor
                    List       (const List& );  // copy constructor
+                   List       (List&& );       // move constructor [16]
     List&          operator = (const List& );  // assignment
+    List&          operator = (List&& );       // move assignment [16]
     virtual List * Clone      () const;        // returns ptr to deep copy of this list [13]
 
     // modifying List structure - mutators
@@ -60,8 +90,20 @@ namespace fsu
     Iterator  Insert     (Iterator i, const T& t);  // Insert t at i  [5]
     ConstIterator  Insert     (ConstIterator i, const T& t);  // ConstIterator version
     Iterator  Insert     (const T& t);   // Insert t                  [6]
+    Iterator  InsertSorted (const T& t); // Insert t after the elements <= t; list in order < [25]
     List&     operator+= (const List& list); // append list
 
+    // move and in-place versions of the inserting mutators [16]
+    bool      PushFront  (T&& t);
+    bool      PushBack   (T&& t);
+    Iterator  Insert     (Iterator i, T&& t);
+    template < class... Args >
+    bool      EmplaceFront (Args&&... args);  // construct T(args...) at front
+    template < class... Args >
+    bool      EmplaceBack  (Args&&... args);  // construct T(args...) at back
+    template < class... Args >
+    Iterator  Emplace      (Iterator i, Args&&... args); // construct T(args...) at i
+
     bool      PopFront  ();              // Remove the Tval at front
     bool      PopBack   ();              // Remove the Tval at back 
     Iterator  Remove    (Iterator i);    // Remove item at I          [7]
@@ -73,19 +115,42 @@ namespace fsu
 
     // macroscopic (whole list) mutators
     void      Sort      ();               // default order <
-    void      Merge     (List<T>& list);  // merges "list" into this list
-    void      Reverse   ();
-    void      Shuffle   ();
+    void      Merge     (List<T,I,A>& list);  // merges "list" into this list
+    void      MergeAll  (List<T,I,A>* lists[], size_t k); // merges k lists into this list [26]
+    void      Reverse   ();               // constant time: flips the direction of the list [23]
+    void      ReverseLinks ();            // reverses the links themselves, linear time [23]
+    void      Shuffle   ();               // fixed permutation, the same every time
+    void      Shuffle   (fsu::RandomBase& ran); // uniform random order drawn from ran [24]
+    void      Shuffle   (uint64_t seed);  // the same, drawn from a RandomBase seeded with seed [24]
+
+    // moving links between lists without copying elements [17]
+    void      Splice    (Iterator pos, List<T,I,A>& list);             // all of list, ahead of pos
+    void      Splice    (Iterator pos, List<T,I,A>& list, Iterator i); // element i of list
+    void      Splice    (Iterator pos, List<T,I,A>& list, Iterator first, Iterator last); // [first,last)
 
     template < class Predicate > // Predicate object used to determine order
     void      Sort      (Predicate& p);
 
+    template < class Predicate > // sorts runs on up to threads threads, 0 = all cores [18]
+    void      Sort      (Predicate& p, size_t threads);
+
     template < class Predicate > // Predicate object used to determine order
-    void      Merge     (List<T>& list, Predicate& p);
+    void      Merge     (List<T,I,A>& list, Predicate& p);
+
+    template < class Predicate > // all lists in order p, merged in one pass [26]
+    void      MergeAll  (List<T,I,A>* lists[], size_t k, Predicate& p);
+
+    template < class Predicate > // list in order p; t goes after the elements it does not precede [25]
+    Iterator  InsertSorted (const T& t, Predicate& p);
 
     // information about the list - accessors
     size_t    Size  () const;  // return the number of elements on the list
     bool      Empty () const;  // true iff list has no elements
+    bool      Sorted () const; // true iff the mutators know the list to be in order < [25]
+
+    // memory held by the list [22]
+    ListStats Stats       () const;  // links, sentinels and bytes by kind
+    size_t    MemoryUsage () const;  // Stats().Bytes()
 
     // accessing values on the list - more accessors
     T&        Front ();        // return reference to Tval at front of list
@@ -93,12 +158,20 @@ namespace fsu
     T&        Back  ();        // return reference to Tval at back of list
     const T&  Back  () const;  // const version
 
+    // positional access; O(log n) with I = SkipIndex, O(n) otherwise [19]
+    T&             At         (size_t k);        // return reference to element k, 0 = front
+    const T&       At         (size_t k) const;  // const version
+    Iterator       IteratorAt (size_t k);        // iterator to element k, End() if k >= Size()
+    ConstIterator  IteratorAt (size_t k) const;  // const version
+    size_t         IndexOf    (ConstIterator i) const; // position of i, Size() for End()
+    Iterator       Advance    (Iterator i, long n);    // i moved n places; End() if that leaves the list
+
     // Iterator support - locating places on the list
     Iterator  Begin      (); // return iterator to front        [9]
     Iterator  End        (); // return iterator "1 past the back"
     Iterator  rBegin     (); // return iterator to back
     Iterator  rEnd       (); // return iterator "1 past the front" in reverse
-    Iterator  Includes   (const T& t); // returns position of first occurrence of t, or End()
+    Iterator  Includes   (const T& t); // returns position of first occurrence of t, or End() [20]
 
     // ConstIterator support
     ConstIterator  Begin      () const;
@@ -116,64 +189,100 @@ namespace fsu
 
   protected:
     // A scope List<T>:: class usable only by its friends (all members are private)
-    class Link
+    class Link : public I::Hook  // per-link data of the index [19]
     {
-      friend class List<T>;
-      friend class ConstListIterator<T>;
-      friend class ListIterator<T>;
+      friend class List<T,I,A>;
+      friend class ConstListIterator<T,I,A>;
+      friend class ListIterator<T,I,A>;
+      friend I;
+      template < class L , class P >
+      friend void SortLinks (L * head, L * tail, P& comp); // list_sort.cpp
+      template < class L , class P , class V >
+      friend void SortLinks (L * head, L * tail, P& comp, V value);
+      template < class L >
+      friend class LinkDirection; // relinking shared with IntrusiveList, list_link.cpp
 
       // Link variables
       T       Tval_;        // data
       Link *  prev_;        // ptr to predecessor Link
       Link *  next_;        // ptr to successor Link
 
-      // Link constructor - parameter required
+      // Link constructors - parameter required
       Link(const T& );
+      template < class... Args >
+      Link(Args&&... args);  // constructs Tval_ in place [16]
     } ;
 
     Link *  head_,  // node representing "one before the first"
          *  tail_;  // node representing "one past the last"
+    size_t  size_;  // number of elements on the list [14]
+    bool    reversed_; // the list runs from head_ to tail_ along prev_ [23]
+    bool    sorted_;   // the list is in order < as far as the mutators know [25]
+    Link *  finger_;   // link placed by the last InsertSorted, or nullptr [25]
+    Pool *  pool_;  // link allocator; nullptr means alloc_ [15]
+    I       index_; // index policy object [19]
+    LinkAllocator alloc_; // allocator for links when pool_ is nullptr [21]
 
     // protected methods -- used only by other methods
+    List (Pool * pool, const LinkAllocator& alloc); // list sharing the allocation of another
     void Init   ();                 // sets up head and tail nodes
     void Append (const List& list); // append deep copy of list
 
-    // protected method isolates memory allocation and associated exception handling
-    static Link * NewLink (const T&);
+    // protected methods isolate memory allocation and associated exception handling
+    template < class... Args >
+    Link * NewLink    (Args&&... args);
+    void   DeleteLink (Link * oldLink);
+
+    // replace the links [first,last) of list y by links from this list's allocation [15]
+    bool   Rehome     (List& y, Link *& first, Link * last);
+
+    // the neighbours of a link in the direction of the list [23]
+    Link *& Next (Link * link) const { return reversed_ ? link->prev_ : link->next_; }
+    Link *& Prev (Link * link) const { return reversed_ ? link->next_ : link->prev_; }
+    LinkDirection<Link> Direction () const { return LinkDirection<Link>(reversed_); }
+    Link *  First () const { return reversed_ ? tail_ : head_; } // ends of the links as the index sees them
+    Link *  Last  () const { return reversed_ ? head_ : tail_; }
 
     // standard link-in and link-out processes
-    static void   LinkIn  (Link * location, Link * newLink);
-    static Link * LinkOut (Link * oldLink);
+    void          LinkIn   (Link * location, Link * newLink);
+    Link *        LinkOut  (Link * oldLink);
+    void          Transfer (Link * location, List& y, Link * first, Link * last); // [first,last) of y ahead of location
+    Link *        Find     (Link * from, const T& t) const; // first link at or after from holding t, or tail_ [20]
+
+    // order checks for sorted_ [25]
+    bool          InOrder  (Link * a, Link * b) const; // b next to a keeps order <, or either is a sentinel
+    template < class P >
+    bool          Ordered  (P& comp) const;            // no element precedes its predecessor under comp
 
     // tight couplings
-    friend class ListIterator<T>;
-    friend class ConstListIterator<T>; // [1]
+    friend class ListIterator<T,I,A>;
+    friend class ConstListIterator<T,I,A>; // [1]
     // numbers in square brackets refer to notes at the end of this file
   } ;
 
   // global scope operators and functions
 
-  template <typename T>
-  bool operator == (const List<T>& list1, const List<T>& list2);
+  template < typename T , class I , class A >
+  bool operator == (const List<T,I,A>& list1, const List<T,I,A>& list2);
 
-  template <typename T>
-  bool operator != (const List<T>& list1, const List<T>& list2);
+  template < typename T , class I , class A >
+  bool operator != (const List<T,I,A>& list1, const List<T,I,A>& list2);
 
-  template <typename T>
-  std::ostream& operator << (std::ostream& os, const List<T>& list);
+  template < typename T , class I , class A >
+  std::ostream& operator << (std::ostream& os, const List<T,I,A>& list);
 
   //----------------------------------
   //     ConstListIterator<T>
   //----------------------------------
 
-  template <typename T>
+  template < typename T , class I , class A >
   class ConstListIterator
   {
   public:
     // terminology support
     typedef T                                      ValueType;
-    typedef ConstListIterator < T >                ConstIterator;
-    typedef ListIterator < T >                     Iterator;
+    typedef ConstListIterator < T , I , A >            ConstIterator;
+    typedef ListIterator < T , I , A >                 Iterator;
 
     // constructors
     ConstListIterator       ();                          // default constructor
@@ -194,32 +303,33 @@ namespace fsu
 
   protected:
     // data
-    typename List<T>::Link * curr_;
+    typename List<T,I,A>::Link * curr_;
+    bool                         rev_;  // reversed_ of the list when the iterator was made [23]
 
     // methods
-    ConstListIterator (typename List<T>::Link * linkPtr); // type converting constructor
+    ConstListIterator (typename List<T,I,A>::Link * linkPtr, bool rev = 0); // type converting constructor
     T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
 
     // tight couplings
-    friend class List<T>;
+    friend class List<T,I,A>;
   } ;
 
   //----------------------------------
   //     ListIterator<T>
   //----------------------------------
 
-  template <typename T>
-  class ListIterator : public ConstListIterator<T>
+  template < typename T , class I , class A >
+  class ListIterator : public ConstListIterator<T,I,A>
   {
   public:
     // terminology support
     typedef T                                      ValueType;
-    typedef ConstListIterator < T >                ConstIterator;
-    typedef ListIterator < T >                     Iterator;
+    typedef ConstListIterator < T , I , A >            ConstIterator;
+    typedef ListIterator < T , I , A >                 Iterator;
 
     // constructors
     ListIterator       ();                       // default constructor
-    ListIterator       (List<T>& );              // initializing constructor
+    ListIterator       (List<T,I,A>& );              // initializing constructor
     ListIterator       (const ListIterator& );   // copy constructor
 
     // information/access
@@ -238,16 +348,18 @@ namespace fsu
 
   protected:
     // methods
-    ListIterator (typename List<T>::Link * linkPtr); // type converting constructor
+    ListIterator (typename List<T,I,A>::Link * linkPtr, bool rev = 0); // type converting constructor
     // T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
 
     // tight couplings
-    friend class List<T>;
+    friend class List<T,I,A>;
   } ;
 
+#include <list_link.cpp>
 #include <list.cpp>
 #include <list_macro.cpp>
 #include <list_sort.cpp>
+#include <list_psort.cpp>
 
 } // namespace fsu
 
@@ -270,8 +382,9 @@ namespace fsu
 
 [3] The error messages generated by List operations are due to
 
-    (a) Failure to allocate new memory. These failures are handled first by the static 
-        NewLink(t) method. When control is returned to the calling method:
+    (a) Failure to allocate new memory. These failures are handled first by the
+        NewLink(t) method, which takes the link from the list's pool_ or alloc_ [15].
+        When control is returned to the calling method:
 
     (b) Calls to access methods (e.g. Front(), Back()) on an empty list.
 
@@ -324,6 +437,168 @@ namespace fsu
      physically they are in different files.
 
 [13] Clone() is used in polymorphic programming
+
+[14] size_ is maintained by every mutator that adds or removes links, so that
+     Size() is a constant time accessor. Macro-mutators that move links from
+     one list to another (Merge, Splice) transfer the count along with the links.
+
+[15] By default each link is allocated by the allocator A [21]. A list
+     constructed with a Pool takes its links (including head_ and tail_) from
+     the pool and returns them to it, so churn recycles links instead of
+     calling malloc/free. Several lists may share one pool:
+
+       fsu::List<T>::Pool pool;
+       fsu::List<T> x(pool), y(pool);
+
+     Copies and Clone() share the pool of the original, and Merge moves links
+     directly when both lists use the same pool. When the pools differ, Merge
+     first re-allocates y's elements in this list's pool, so that no list
+     ever holds a link from a foreign arena. The pool must outlive every list
+     that uses it.
+
+[16] The move constructor steals the links of its argument, which is left as
+     an empty list (with fresh head_ and tail_ links). Move assignment
+     exchanges the links of the two lists. Both are constant time.
+     PushFront/PushBack/Insert taking T&& move the argument into the new
+     link, and the Emplace versions construct the element in the new link
+     from the given constructor arguments, so no temporary T is made.
+
+[17] Splice(pos, x, ...) unlinks elements from x and links them into this list
+     ahead of pos, so no element is copied and no link is allocated; iterators
+     to the moved elements stay attached to them, now in this list, as long
+     as the two lists run in the same direction [23]. pos may be End() but
+     not rEnd(); x may be this list for the single element and range
+     versions, in which case pos must not lie inside the range. Splicing all
+     of x and a single element are constant time; the range version walks
+     [first,last) once to keep Size() exact, unless x is this list. Moving
+     links between lists of opposite direction flips each one, which makes
+     every version linear in the number moved. When the two lists use
+     different pools the moved elements are re-allocated in this list's pool
+     as for Merge [15], which does copy them.
+     Concatenating partial results with x.Splice(x.End(), y) replaces the
+     deep copy made by x += y.
+
+[18] Sort(p,threads) cuts the list into runs of equal length, sorts the runs
+     concurrently with the serial Sort(p), then combines neighbouring runs with
+     Merge(list,p) in rounds, also concurrently, until one run is left. Runs
+     are cut from consecutive positions and Merge keeps ties in the order of
+     the left run, so the result is the same stable order Sort(p) gives.
+     Lists shorter than 2 * LIST_SORT_MIN_RUN elements (the macro may be set
+     on the compiler command line) are sorted by Sort(p) on the calling
+     thread. p is called from several threads at once and so must not change
+     shared state. Links are only relinked, and the runs share this list's
+     pool, so no link is allocated other than the head_ and tail_ of each
+     run. Programs using it are built with -pthread.
+
+[19] The second template argument is an index policy (linkindex.h). The
+     default, NoIndex, adds nothing to the links, and the positional
+     methods At, IteratorAt, IndexOf and Advance walk the list. With
+
+       fsu::List<T,fsu::SkipIndex> x;
+
+     every link also derives from SkipIndex::Hook, and about a quarter of
+     them carry a tower of an indexable skip list, so the positional methods
+     take O(log n) expected time. LinkIn and LinkOut keep the index up to
+     date, so the pushes, pops, Insert, Remove and single element Splice
+     cost O(log n) instead of O(1). Sort, Merge, ReverseLinks, Shuffle and the
+     other Splice versions relink many links and then rebuild the index in
+     one linear pass. Iterators of the two kinds of list are different
+     types, and links can only move between lists with the same policy.
+     The policy object is the member index_, so even NoIndex adds a few
+     bytes to each List object (not to its links).
+
+[20] IndexedList<T,H> is List<T,HashIndex<H>>: every link is also in a
+     hash table keyed by H()(Tval_), chained through the links themselves.
+     Includes(t) is then O(1) expected and Remove(t) O(k) for k copies of t,
+     at the cost of one hash in each push, Insert and Remove, and a rehash
+     of the whole list after Sort, Merge, ReverseLinks, Shuffle, Splice and copy
+     assignment. With more than one copy of t, Includes(t) returns one of
+     them but not necessarily the first. The table is keyed by value, so an
+     element must not be changed through an iterator, Front, Back or At
+     while it is on an IndexedList; CheckLinks reports such an element as a
+     hash index failure. T needs operator== as well as the hash.
+
+[21] The third template argument is a standard allocator for T; the list
+     rebinds it to Link and uses it for every link, head_ and tail_
+     included, unless the list was given a Pool. The default,
+     std::allocator<T>, allocates with operator new as before. A stateful
+     allocator is passed to the constructor
+
+       ArenaAllocator<char> alloc(arena);
+       fsu::List<char,fsu::NoIndex,ArenaAllocator<char>> x(alloc);
+
+     and is shared by copies, Clone and moved-from lists, and exchanged by
+     move assignment. Merge and Splice relink links only between lists whose
+     allocators compare equal; otherwise the elements are re-allocated as
+     for differing pools [15]. An allocator that throws std::bad_alloc is
+     handled like a failed new: NewLink reports the failure and the
+     operation returns its failure value.
+
+[22] Stats() counts the links of this list, head_ and tail_ included, at
+     sizeof(Link) each, the List object, the heap held by the index policy
+     (SkipIndex towers, the HashIndex bucket array), and for types with a
+     PayloadBytes specialization, such as fsu::String, the heap owned by
+     the elements (liststats.h). Only the payload needs a walk of the list.
+     Each link carries two pointers besides Tval_ and the index Hook, so
+     for small T the bytes per element are several times sizeof(T).
+
+[23] Reverse() swaps head_ and tail_ and flips reversed_; no link is
+     touched and the index is kept, so it takes constant time. When
+     reversed_ is set, "next" means prev_ throughout: Begin, End, the
+     pushes and pops, Insert and Remove, Merge, Sort and Splice all walk
+     the links through Next() and Prev(). An iterator copies reversed_
+     when it is made, so Reverse() invalidates the iterators of the list:
+     they still point at their elements, but ++ and -- run the old way.
+     Moving links between lists of opposite direction flips each moved
+     link, so it is linear in the number moved, and iterators to the moved
+     elements are invalidated the same way. Between lists of the same
+     direction, and in a move of the whole list, they stay valid [17].
+     The index policy always sees the links from the one with no prev_
+     (First()) to the one with no next_ (Last()), and positions are
+     converted, so At and IndexOf keep their meaning. ReverseLinks() is
+     the former Reverse(): it reverses prev_ and next_ of every element
+     link, as IntrusiveList::Reverse() does (list_link.cpp), keeps head_,
+     tail_ and reversed_, and rebuilds the index, for clients that hand
+     the links to code unaware of the direction.
+
+[24] Shuffle(ran) is a Fisher-Yates shuffle: the links are gathered into
+     a temporary array of pointers, the array is permuted with draws of
+     ran.Below(), and the links are relinked in the new order. Every
+     order is equally likely, each call is O(n) with a single allocation
+     of n pointers, and no element is copied or moved, so iterators stay
+     with their elements. Shuffle(seed) repeats its order for a given
+     seed. Both need xran.cpp to be linked. Shuffle() keeps the fixed
+     deal of every 2nd and 3rd element to the front.
+
+[25] sorted_ records that the list is in the default order <. It is set
+     by Sort(), kept by the pushes and inserts with one comparison
+     against each new neighbour (none once it is false), by removals,
+     and by Merge and Splice of sorted lists at sorted boundaries, and
+     cleared by Reverse, Shuffle and Sort(p) for any other p. Values
+     changed through iterators, Front, Back or At are not seen, so it is
+     a hint: Sort() on a list marked sorted checks the order in O(n) and
+     returns if it holds, and Sort(p) for other p always makes that check
+     first, which stops at the first element out of order. Types without
+     operator < are never marked sorted beyond one element.
+     InsertSorted(t,p) requires the list in order p and puts t after the
+     elements it does not precede, so equal elements keep their order of
+     insertion. It gallops from finger_, the link of the last
+     InsertSorted (or from the back), then searches the bracket found:
+     O(log d) comparisons for a place d links away, with O(d) steps, so
+     mostly ordered input costs O(1) per insert. finger_ is dropped when
+     its link is removed or may have been moved to another list.
+
+[26] MergeAll(lists,k,p) merges this list and lists[0..k) in one pass: a
+     loser tree over the fronts of the lists picks each next link with
+     about log2(k+1) comparisons, and the link is relinked onto this list,
+     so merging k sorted shards costs O(n log k) comparisons instead of
+     the O(n k) of k calls to Merge. Ties go to this list, then to the
+     lists in index order, which is the order k calls to Merge(lists[j],p)
+     would give. Null pointers, this list, and repeats in lists[] are
+     skipped; the lists merged are left empty. A list whose links must be
+     rehomed [21] and cannot be is left as it was. If the three small
+     arrays the tree needs cannot be allocated, the lists are merged one
+     at a time instead.
 */
 
 #endif
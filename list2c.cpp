@@ -14,10 +14,10 @@
 
 // --Stand alone functions: These functions are global functions and are not part of any class
 
-template < typename T >
-bool operator == (const List<T> &x1, const List<T> &x2)
+template < typename T , class I , class A , class R >
+bool operator == (const List<T,I,A,R> &x1, const List<T,I,A,R> &x2)
 {
-    typename List<T>::ConstIterator i1, i2;  //declare an iterator to traverse each list
+    typename List<T,I,A,R>::ConstIterator i1, i2;  //declare an iterator to traverse each list
     for (                                    //are of the proper type
          i1 = x1.Begin(), i2 = x2.Begin();          //position iterators at 1st valid node
          (i1 != x1.End()) && (i2 != x2.End());      //stop iterators once they reach last valid node
@@ -33,15 +33,15 @@ bool operator == (const List<T> &x1, const List<T> &x2)
 }
 
 
-template < typename T >
-bool operator != (const List<T>& x1, const List<T>& x2)
+template < typename T , class I , class A , class R >
+bool operator != (const List<T,I,A,R>& x1, const List<T,I,A,R>& x2)
 {
     return !(x1 == x2);  //utilize == operator function
 }
 
 
-template < typename T >
-std::ostream& operator << (std::ostream& os, const List<T> list)
+template < typename T , class I , class A , class R >
+std::ostream& operator << (std::ostream& os, const List<T,I,A,R> list)
 {
     list.Display(os);
     return os;  //enables chaining in output statements e.g. L1 << L2 << L3
@@ -56,35 +56,238 @@ std::ostream& operator << (std::ostream& os, const List<T> list)
 // --Memory allocator and other private (or protected) methods
 
 //Link constructor
-template < typename T >
-List<T>::Link::Link (const T& Tval) : Tval_(Tval), prev_(nullptr), next_(nullptr)
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::Link::Link (const T& Tval) : Tval_(Tval), prev_(0), next_(nullptr), block_(nullptr)
 {}
 
-template < typename T >
-typename List<T>::Link * List<T>::NewLink (const T &t)
+//Link constructor that builds the T value in place from constructor arguments
+template < typename T , class I , class A , class R >
+template < class... Args >
+List<T,I,A,R>::Link::Link (Args&&... args) : Tval_(std::forward<Args>(args)...), prev_(0), next_(nullptr), block_(nullptr)
+{}
+
+template < typename T , class I , class A , class R >
+template < class... Args >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::NewLink (Args&&... args)
 {
-    Link * newLink = new(std::nothrow) Link(t);
+    typedef std::allocator_traits < decltype(alloc_) > Traits;
+    Link * newLink = nullptr;
+    try
+    {
+        newLink = Traits::allocate(alloc_, 1);
+    }
+    catch (const std::bad_alloc&)
+    {
+        newLink = nullptr;
+    }
     if (nullptr == newLink) //check if allocation worked
     {
         //exception handler
         std::cerr << "*:ost error: memory allocation failure.\n";
         return nullptr;
     }
-    return newLink; //returns the addres of the newly created link
+    retain_.Allocated();
+    return new(newLink) Link(std::forward<Args>(args)...); //returns the addres of the newly created link
+}
+
+//NewBlock - allocates n links in one call: n + 1 Link slots, the first holding the Block
+//header that counts them. The links hold T() and are chained in the direction of the list,
+//from the returned first link to first + n - 1. Returns nullptr, silently, if the allocator
+//fails, so that the caller can ask for less.
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::NewBlock (size_t n)
+{
+    static_assert(sizeof(Block) <= sizeof(Link), "the Block header takes one Link slot");
+    typedef std::allocator_traits < decltype(alloc_) > Traits;
+    Link * slots = nullptr;
+    try
+    {
+        slots = Traits::allocate(alloc_, n + 1);
+    }
+    catch (const std::bad_alloc&)
+    {
+        slots = nullptr;
+    }
+    if (nullptr == slots)
+        return nullptr;
+    Block * block = new(static_cast<void*>(slots)) Block;
+    block->links_ = n;
+    block->size_ = n;
+    Link * first = slots + 1;
+    for (size_t k = 0; k < n; ++k)
+    {
+        Link * link = new(first + k) Link();
+        link->block_ = block;
+        if (k > 0)
+        {
+            Next(link - 1) = link;
+            Prev(link) = link - 1;
+        }
+    }
+    retain_.Allocated(n);
+    return first;
+}
+
+//DeleteLink - returns a link to the allocator NewLink got it from; a link of a block only
+//counts down its block, which goes back to the allocator with its last link. A link whose
+//block stays is counted in pinned_, and a block that goes takes its earlier links out again.
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::DeleteLink (Link * oldLink)
+{
+    typedef std::allocator_traits < decltype(alloc_) > Traits;
+    Block * block = oldLink->block_;
+    oldLink->~Link();
+    if (block == nullptr)
+        Traits::deallocate(alloc_, oldLink, 1);
+    else if (--block->links_ > 0)
+        ++pinned_;
+    else
+    {
+        size_t earlier = block->size_ - 1; //possibly freed by another list, after a Merge or Splice
+        pinned_ -= earlier < pinned_ ? earlier : pinned_;
+        Traits::deallocate(alloc_, reinterpret_cast<Link*>(block), block->size_ + 1);
+    }
+}
+
+//Compact - moves the values of the whole ring, head_ and tail_ included, into one new block
+//in ring order and frees the old links, so that the blocks they pinned go back to the
+//allocator; returns the new address of link. Every iterator of the list is left dangling.
+//If the block cannot be allocated the ring stays as it is.
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::Compact (Link * link)
+{
+    size_t n = size_ + excess_ + 2;
+    Link * fresh = NewBlock(n);
+    if (fresh == nullptr)
+        return link;
+    Link * old = head_, * moved = link, * tail = fresh;
+    for (size_t k = 0; k < n; ++k)
+    {
+        Link * next = Next(old);
+        fresh[k].Tval_ = std::move(old->Tval_);
+        if (old == link) moved = fresh + k;
+        if (old == tail_) tail = fresh + k;
+        DeleteLink(old);
+        old = next;
+    }
+    Next(fresh + (n - 1)) = fresh; //close the ring
+    Prev(fresh) = fresh + (n - 1);
+    head_ = fresh;
+    tail_ = tail;
+    pinned_ = 0;
+    retain_.Freed(n);
+    index_.Rebuild(First(),Last());
+    return moved;
+}
+
+//Unpin - compacts the ring once more links have been freed from blocks that stay than the
+//ring has, so that the blocks held hold at most about twice the ring; the cost of a
+//compaction is paid for by the frees that triggered it. Returns where link is afterwards.
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::Unpin (Link * link)
+{
+    if (pinned_ > size_ + excess_ + 2)
+        link = Compact(link);
+    return link;
+}
+
+//Vacate - the links of [first,last) have just left the active part of the ring; unless the
+//list keeps spare values, each value is replaced by T(), releasing what it owned
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Vacate (Link * first, Link * last)
+{
+    if (keepValues_) return;
+    for ( ; first != last; first = Next(first))
+        first->Tval_ = T();
+}
+
+//Retain - asks the retention policy how many unused links to free after a removal; returns
+//where link is afterwards, since the trim may compact the ring [4]
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::Retain (Link * link)
+{
+    size_t n = retain_.Trim(size_, excess_);
+    if (n > excess_) n = excess_;
+    if (n > 0)
+    {
+        retain_.Freed(FreeSpares(excess_ - n));
+        link = Unpin(link);
+    }
+    return link;
+}
+
+//AddSpares - allocates n links as one block and splices them in after the tail in one step;
+//a block the allocator refuses is halved until it fits, and a single link is allocated on
+//its own. Returns the number added, fewer than n only if the allocator failed.
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::AddSpares (size_t n)
+{
+    if (n == 0) return 0;
+    Link * first = nullptr;
+    for (size_t count = n; first == nullptr && count > 1; count /= 2)
+    {
+        first = NewBlock(count);
+        n = count;
+    }
+    if (first == nullptr)
+    {
+        first = NewLink();
+        n = 1;
+        if (first == nullptr) return 0;
+    }
+    Link * last = first + (n - 1);
+    size_t count = n;
+    Link * after = Next(tail_); //the unused links run from Next(tail_) to Prev(head_)
+    Next(tail_) = first;
+    Prev(first) = tail_;
+    Next(last) = after;
+    Prev(after) = last;
+    excess_ += count;
+    return count;
+}
+
+//Grow - gives a full ring the batch of unused links retain_ advises for its size, so that
+//a list growing by pushes allocates in batches of geometrically growing size
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::Grow ()
+{
+    size_t n = retain_.Grow(size_);
+    return AddSpares(n > 0 ? n : 1) > 0;
+}
+
+// -- Refill methods: a link taken from the unused part of the ring already holds a T,
+// so the new value is assigned rather than constructed
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Refill (Link * link, const T &t)
+{
+    link->Tval_ = t;
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Refill (Link * link, T &&t)
+{
+    link->Tval_ = std::move(t);
+}
+
+template < typename T , class I , class A , class R >
+template < class... Args >
+void List<T,I,A,R>::Refill (Link * link, Args&&... args)
+{
+    link->Tval_ = T(std::forward<Args>(args)...);
 }
 
 // -- LinkIn and LinkOut methods
-template < typename T >
-void List<T>::LinkIn(typename List<T>::Link * location, typename List<T>::Link * newLink)
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::LinkIn(typename List<T,I,A,R>::Link * location, typename List<T,I,A,R>::Link * newLink)
 {
-    newLink->next_ = location; // set newLink's next pointer to location of node following head
-    newLink->prev_ = location->prev_; //set newLink's prev prointer to head node
-    newLink->next_->prev_ = newLink;
-    newLink->prev_->next_ = newLink;
+    Next(newLink) = location; // set newLink's next pointer to location of node following head
+    Prev(newLink) = Prev(location); //set newLink's prev prointer to head node
+    Prev(location) = newLink;
+    Next(Prev(newLink)) = newLink;
 }
 
-template < typename T >
-typename List<T>::Link * List<T>::LinkOut(typename List<T>::Link * oldLink)
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::LinkOut(typename List<T,I,A,R>::Link * oldLink)
 {
     //Note: This method moves the oldLink to the end of the tail node.
     oldLink->prev_->next_ = oldLink->next_; //set next link to previous link as link following old link
@@ -94,10 +297,39 @@ typename List<T>::Link * List<T>::LinkOut(typename List<T>::Link * oldLink)
     return oldLink; //returns the location of oldLink (needed for other operations)
 }
 
+//unlink the non-empty chain [first,last) from y and link it in front of location in this list
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Transfer(typename List<T,I,A,R>::Link * location, List<T,I,A,R> &y, typename List<T,I,A,R>::Link * first, typename List<T,I,A,R>::Link * last)
+{
+    Link * back = y.Prev(last); //last link of the chain being moved
+    y.Next(y.Prev(first)) = last; //close the gap left behind
+    y.Prev(last) = y.Prev(first);
+    if (y.reversed_ != reversed_) //the chain runs the other way in this list, so each link is flipped
+    {
+        for (Link * link = first; link != last; )
+        {
+            Link * next = y.Next(link);
+            std::swap(link->prev_, link->next_);
+            link = next;
+        }
+    }
+    Prev(first) = Prev(location); //attach the chain in front of location
+    Next(back) = location;
+    Next(Prev(location)) = first;
+    Prev(location) = back;
+}
+
+//search from "from" toward tail_ in the direction of the list
+template < typename T , class I , class A , class R >
+typename List<T,I,A,R>::Link * List<T,I,A,R>::Find(typename List<T,I,A,R>::Link * from, const T &t) const
+{
+    return reversed_ ? index_.FindBack(from, tail_, t) : index_.Find(from, tail_, t);
+}
+
 //Initialize a ciruclar list; note that head's next_ and prev_ pointers both point to tail
 //and vice-versa to fulfull the cirucular idea
-template < typename T >
-void List<T>::Init()
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Init()
 {
     head_ = NewLink(T());
     tail_ = NewLink(T());
@@ -105,10 +337,15 @@ void List<T>::Init()
     head_->prev_ = tail_;
     tail_->next_ = head_;
     tail_->prev_ = head_;
+    size_ = 0;
+    excess_ = 0;
+    pinned_ = 0;
+    reversed_ = 0;
+    index_.Init(head_,tail_);
 }
 
-template < typename T >
-void List<T>::Init(T fill) //constructor used in development version
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Init(T fill) //constructor used in development version
 {
     head_ = NewLink(fill);
     tail_ = NewLink(fill);
@@ -116,12 +353,18 @@ void List<T>::Init(T fill) //constructor used in development version
     head_->prev_ = tail_;
     tail_->next_ = head_;
     tail_->prev_ = head_;
+    size_ = 0;
+    excess_ = 0;
+    pinned_ = 0;
+    reversed_ = 0;
+    index_.Init(head_,tail_);
 }
 
 //Append method - works the same as the linear case; appends deep copy of rhs
-template < typename T >
-void List<T>::Append (const List<T> &list)
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Append (const List<T,I,A,R> &list)
 {
+    Reserve(list.size_); //the links missing, in one block; on failure the pushes grow the ring
     for (ConstIterator i = list.Begin(); i != list.End(); ++i)
         PushBack(*i);
 }
@@ -135,54 +378,108 @@ void List<T>::Append (const List<T> &list)
 // - Constructors and assignment for the lists
 
 //default constructor
-template < typename T >
-List<T>::List () : head_(nullptr), tail_(nullptr)
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::List () : head_(nullptr), tail_(nullptr), size_(0), excess_(0), pinned_(0), reversed_(0), keepValues_(1), alloc_()
+{
+    Init();
+}
+
+//constructor with an allocator; every link, head and tail included, comes from a copy of alloc
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::List (const A &alloc) : head_(nullptr), tail_(nullptr), size_(0), excess_(0), pinned_(0), reversed_(0), keepValues_(1), alloc_(alloc)
 {
     Init();
 }
 
 //constructor for development version
-template < typename T >
-List<T>::List (T fill): head_(nullptr), tail_(nullptr)
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::List (T fill): head_(nullptr), tail_(nullptr), size_(0), excess_(0), pinned_(0), reversed_(0), keepValues_(1), alloc_()
 {
     Init(fill);
 }
 
 //destructor
-template < typename T >
-List<T>::~List ()
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::~List ()
 {
-    Release();
-    delete head_;
-    delete tail_;
+    Link * link = head_; //every link of the ring, head and tail included
+    for (size_t k = size_ + excess_ + 2; k > 0; --k)
+    {
+        Link * next = link->next_;
+        DeleteLink(link);
+        link = next;
+    }
 }
 
 
 //copy constructor
-template < typename T >
-List<T>::List (const List<T> &x) : head_(nullptr), tail_(nullptr)
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::List (const List<T,I,A,R> &x) : head_(nullptr), tail_(nullptr), size_(0), excess_(0), pinned_(0), reversed_(0), keepValues_(x.keepValues_), alloc_(x.alloc_), retain_(x.retain_)
 {
     Init(); //initialize normally
     Append(x); //append the list to the available nodes
 }
 
+//move constructor - takes the ring of x and gives x a fresh empty one
+template < typename T , class I , class A , class R >
+List<T,I,A,R>::List (List<T,I,A,R> &&x) : head_(x.head_), tail_(x.tail_), size_(x.size_), excess_(x.excess_), pinned_(x.pinned_), reversed_(x.reversed_), keepValues_(x.keepValues_), index_(std::move(x.index_)), alloc_(x.alloc_), retain_(x.retain_)
+{
+    x.Init();
+}
+
 //assignment operator
-template < typename T >
-List<T>& List<T>::operator = (const List<T> &rhs) //return type List<T>& allows for chaining
+template < typename T , class I , class A , class R >
+List<T,I,A,R>& List<T,I,A,R>::operator = (const List<T,I,A,R> &rhs) //return type List<T>& allows for chaining
 {
     if (this != &rhs) //first check for self assignment
     {
-        Release(); //delete every node except head and tail; relink head and tail
-        Append(rhs); //build a copy as *this
+        //overwrite the values in the active links
+        Link * curr = Next(head_);
+        Link * from = rhs.Next(rhs.head_);
+        for ( ; curr != tail_ && from != rhs.tail_; curr = Next(curr), from = rhs.Next(from))
+            curr->Tval_ = from->Tval_;
+        if (curr != tail_) //rhs is shorter: the rest of the active links become unused, as in Clear()
+        {
+            Vacate(curr, tail_);
+            T tailValue = tail_->Tval_;
+            tail_ = curr;
+            tail_->Tval_ = tailValue;
+            excess_ += size_ - rhs.size_;
+            size_ = rhs.size_;
+            Retain(); //the retention policy may free the links given up
+        }
+        index_.Rebuild(First(),Last()); //the overwritten values
+        Reserve(rhs.size_ - size_); //the links missing, in one block
+        for ( ; from != rhs.tail_; from = rhs.Next(from))
+            PushBack(from->Tval_); //takes unused links before allocating new ones
     }
     return *this;
 }
 
+//move assignment - exchanges rings with rhs, which takes the old elements
+template < typename T , class I , class A , class R >
+List<T,I,A,R>& List<T,I,A,R>::operator = (List<T,I,A,R> &&rhs)
+{
+    std::swap(head_, rhs.head_);
+    std::swap(tail_, rhs.tail_);
+    std::swap(size_, rhs.size_);
+    std::swap(excess_, rhs.excess_);
+    std::swap(pinned_, rhs.pinned_);
+    std::swap(reversed_, rhs.reversed_);
+    std::swap(keepValues_, rhs.keepValues_);
+    std::swap(index_, rhs.index_);
+    std::swap(alloc_, rhs.alloc_);
+    std::swap(retain_, rhs.retain_);
+    return *this;
+}
+
 //Clone operation -- returns pointer to copy of *this
-template < typename T >
-List<T> * List<T>::Clone() const
+template < typename T , class I , class A , class R >
+List<T,I,A,R> * List<T,I,A,R>::Clone() const
 {
-    List * clone = new List;
+    List * clone = new List(A(alloc_));
+    clone->retain_ = retain_;
+    clone->keepValues_ = keepValues_;
     clone->Append(*this);
     return clone;
 }
@@ -195,128 +492,198 @@ List<T> * List<T>::Clone() const
 // - General List<T> function
 
 //PushFront operation - inserts t at the front of the list
-template < typename T >
-bool List<T>::PushFront (const T &t)
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PushFront (const T &t)
 {
-    //Case 1: There are no excess nodes available
-    if (Excess() == 0)
-    {
-        Link * newLink = NewLink(t); //create a new link; newLink is address of new Link
-        if (newLink == nullptr) return 0; //if allocation fails
-        LinkIn(head_->next_, newLink); //insert the new link into the list after the head node
-        return 1;
-    }
-    else //Case 2: There are excess nodes available
-    {
-        head_->Tval_ = t; //set t to the T value contained in current head node
-        head_ = head_->prev_; // move head forward one node
-        return 1;
-    }
+    if (excess_ == 0 && !Grow()) //a full ring first gets a batch of unused links
+        return 0;
+    head_->Tval_ = t; //set t to the T value contained in current head node
+    head_ = Prev(head_); // move head forward one node
+    index_.LinkedIn(Next(head_)); //the refilled link is now active
+    --excess_;
+    ++size_;
+    return 1;
 }
 
 // PushBack operation - inserts t at the back of the list
-template < typename T >
-bool List<T>::PushBack (const T &t)
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PushBack (const T &t)
 {
-    //Case 1: There are no excess nodes available
-    if (Excess() == 0)
-    {
-        Link * newLink = NewLink(t);
-        if (newLink == nullptr) return 0;
-        LinkIn(tail_,newLink);  //insert new link right before tail_ node
-        return 1;
-    }
-    else //Case 2: There are excess nodes available
-    {
-        tail_->Tval_ = t; //set t to the T value contained in tail node
-        tail_ = tail_->next_; //move tail forward 1 one
-        return 1;
-    }
+    if (excess_ == 0 && !Grow())
+        return 0;
+    tail_->Tval_ = t; //set t to the T value contained in tail node
+    tail_ = Next(tail_); //move tail forward 1 one
+    index_.LinkedIn(Prev(tail_)); //the refilled link is now active
+    --excess_;
+    ++size_;
+    return 1;
 }
 
 // Insert Operation
-template < typename T >
-ListIterator<T> List<T>::Insert (ListIterator<T> i, const T &t)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Insert (ListIterator<T,I,A,R> i, const T &t)
 {
-    //Case 1: There are no excess nodes available
-    if (Excess() == 0)
+    if (Empty()) //always insert if the list is empty
     {
-        if (Empty()) //always insert if the list is empty
-        {
-            i = End(); //will set the iterator to "1 past back" ie the tail node
-        }
-        
-        if (!i.Valid()) //if the iterator is not valid
-        {
-            std::cerr << " ** cannot insert at position -1\n";
-            return End(); //returns tail position
-        }
-        Link * newLink = NewLink(t);
-        if (newLink == nullptr) return 0; //problem with memory allocation
-        LinkIn(i.curr_,newLink); //insert link at specified location
-        i.curr_ = newLink; //set i to new link location
-        return i;
+        i = End(); //will set the iterator to "1 past back" ie the tail node
+    }
+    
+    if (!i.Valid()) //if the iterator is not valid
+    {
+        std::cerr << " ** cannot insert at position -1\n";
+        return End(); //returns tail position
     }
-    else //Case 2: There are excess nodes available
+
+    if (excess_ == 0 && !Grow())
+        return End(); //problem with memory allocation
+
+    //change tail node to T value, then re-assign addresses
+    Link * InsertLink = tail_; //the former tail link will hold t
+    tail_->Tval_ = t; //set t to the T value contained in current tail node
+    tail_ = Next(tail_); //advance the tail node
+    if (i.curr_ != InsertLink) //when inserting at End() the former tail is already in position
     {
-        
-        //change tail node to T value, then re-assign addresses
-        tail_->Tval_ = t; //set t to the T value contained in current tail node
-        tail_ = tail_ -> next_; //advance the tail node
-        Link * InsertLink = LinkOut(tail_->prev_); //obtain address of link of former tail; remove from list
+        LinkOut(InsertLink); //remove former tail from its place at the back
         LinkIn(i.curr_,InsertLink); //put the former tail link in the indicated position
-        i.curr_ = InsertLink; //set iterator to point to inserted link
-        *i = t; //set t value to the T value in the link
-        return i;
     }
+    index_.LinkedIn(InsertLink);
+    --excess_;
+    ++size_;
+    i.curr_ = InsertLink; //set iterator to point to inserted link
+    i.rev_ = reversed_;
+    return i;
 } // end insert
 
 // Insert operation
-template < typename T >
-ConstListIterator<T> List<T>::Insert (ConstListIterator<T> i, const T &t)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::Insert (ConstListIterator<T,I,A,R> i, const T &t)
 {
-    //Case 1: There are no excess nodes available
-    if (Excess() == 0)
+    if (Empty()) //always insert if the list is empty
     {
-        if (Empty()) //always insert if the list is empty
-        {
-            i = End(); //will set the iterator to "1 past back" ie the tail node
-        }
-        
-        if (!i.Valid()) //if the iterator is not valid
-        {
-            std::cerr << " ** cannot insert at position -1\n";
-            return End(); //returns tail position
-        }
-        Link * newLink = newLink(t);
-        if (newLink == nullptr) return 0; //problem with memory allocation
-        LinkIn(i.curr_,newLink); //insert link at specified location
-        i.curr_ = newLink; //set i to new link location
-        return i;
+        i = End(); //will set the iterator to "1 past back" ie the tail node
+    }
+    
+    if (!i.Valid()) //if the iterator is not valid
+    {
+        std::cerr << " ** cannot insert at position -1\n";
+        return End(); //returns tail position
     }
-    else //Case 2: There are excess nodes available
+
+    if (excess_ == 0 && !Grow())
+        return End(); //problem with memory allocation
+
+    //change tail node to T value, then re-assign addresses
+    Link * InsertLink = tail_; //the former tail link will hold t
+    tail_->Tval_ = t; //set t to the T value contained in current tail node
+    tail_ = Next(tail_); //advance the tail node
+    if (i.curr_ != InsertLink) //when inserting at End() the former tail is already in position
     {
-        //change tail node to T value, then re-assign addresses
-        tail_->Tval_ = t; //set t to the T value contained in current tail node
-        tail_ = tail_ -> next_; //advance the tail node
-        Link * InsertLink = LinkOut(tail_->prev_); //obtain address of link of former tail; remove from list
+        LinkOut(InsertLink); //remove former tail from its place at the back
         LinkIn(i.curr_,InsertLink); //put the former tail link in the indicated position
-        i.curr_ = InsertLink; //set iterator to point to inserted link
-        *i = t; //set t value to the T value in the link
-        return i;
     }
+    index_.LinkedIn(InsertLink);
+    --excess_;
+    ++size_;
+    i.curr_ = InsertLink; //set iterator to point to inserted link
+    i.rev_ = reversed_;
+    return i;
 }
 
 // Inserts at default location using End() to obtain location of last link before tail
-template < typename T >
-ListIterator<T> List<T>::Insert (const T &t)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Insert (const T &t)
 {
     return Insert(End(), t);
 }
 
+// move versions of the inserting mutators
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PushFront (T &&t)
+{
+    return EmplaceFront(std::move(t));
+}
+
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PushBack (T &&t)
+{
+    return EmplaceBack(std::move(t));
+}
+
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Insert (ListIterator<T,I,A,R> i, T &&t)
+{
+    return Emplace(i, std::move(t));
+}
+
+// EmplaceFront - constructs T(args...) at the front of the list
+template < typename T , class I , class A , class R >
+template < class... Args >
+bool List<T,I,A,R>::EmplaceFront (Args&&... args)
+{
+    if (excess_ == 0 && !Grow())
+        return 0;
+    Refill(head_, std::forward<Args>(args)...);
+    head_ = Prev(head_);
+    index_.LinkedIn(Next(head_));
+    --excess_;
+    ++size_;
+    return 1;
+}
+
+// EmplaceBack - constructs T(args...) at the back of the list
+template < typename T , class I , class A , class R >
+template < class... Args >
+bool List<T,I,A,R>::EmplaceBack (Args&&... args)
+{
+    if (excess_ == 0 && !Grow())
+        return 0;
+    Refill(tail_, std::forward<Args>(args)...);
+    tail_ = Next(tail_);
+    index_.LinkedIn(Prev(tail_));
+    --excess_;
+    ++size_;
+    return 1;
+}
+
+// Emplace - constructs T(args...) at (in front of) i; returns i at the new element
+template < typename T , class I , class A , class R >
+template < class... Args >
+ListIterator<T,I,A,R> List<T,I,A,R>::Emplace (ListIterator<T,I,A,R> i, Args&&... args)
+{
+    if (Empty()) //always insert if the list is empty
+    {
+        i = End();
+    }
+    
+    if (!i.Valid()) //if the iterator is not valid
+    {
+        std::cerr << " ** cannot insert at position -1\n";
+        return End();
+    }
+
+    if (excess_ == 0 && !Grow())
+        return End();
+
+    //use the tail link as in Insert
+    Link * InsertLink = tail_;
+    Refill(tail_, std::forward<Args>(args)...);
+    tail_ = Next(tail_);
+    if (i.curr_ != InsertLink)
+    {
+        LinkOut(InsertLink);
+        LinkIn(i.curr_,InsertLink);
+    }
+    index_.LinkedIn(InsertLink);
+    --excess_;
+    ++size_;
+    i.curr_ = InsertLink;
+    i.rev_ = reversed_;
+    return i;
+}
+
 // append list
-template < typename T >
-List<T>& List<T>::operator += (const List<T> &list)
+template < typename T , class I , class A , class R >
+List<T,I,A,R>& List<T,I,A,R>::operator += (const List<T,I,A,R> &list)
 {
     if (this != &list) //check for self assignment
         Append(list);
@@ -324,8 +691,8 @@ List<T>& List<T>::operator += (const List<T> &list)
 }
 
 // Removes item in the front of the list by advancing head node
-template < typename T >
-bool List<T>::PopFront()
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PopFront()
 {
     if (Empty()) //if the list is empty, report an error and return false
     {
@@ -333,13 +700,18 @@ bool List<T>::PopFront()
         return 0;
     }
     
-    head_ = head_->next_;
+    index_.LinkingOut(Next(head_)); //the front link becomes unused
+    head_ = Next(head_);
+    Vacate(head_, Next(head_)); //the old front is the new head
+    --size_;
+    ++excess_;
+    Retain();
     return 1; //successful
 }
 
 // Removes item in the back of the list by retreating tail node
-template < typename T >
-bool List<T>::PopBack()
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::PopBack()
 {
     if (Empty()) //if the list is empty, report an
     {
@@ -347,18 +719,23 @@ bool List<T>::PopBack()
         return 0;
     }
     
-    tail_ = tail_->prev_;
+    index_.LinkingOut(Prev(tail_)); //the back link becomes unused
+    tail_ = Prev(tail_);
+    Vacate(tail_, Next(tail_)); //the old back is the new tail
+    --size_;
+    ++excess_;
+    Retain();
     return 1; //successful
 }
 
-//Remove an item at i; note this does not delete the actual link as per Circular list implementation plan
-template < typename T >
-ListIterator<T> List<T>::Remove (ListIterator<T> i)
+//Remove the item at i; its link moves to the unused part of the ring, after the tail,
+//where the retention policy may then free it
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Remove (ListIterator<T,I,A,R> i)
 {
-    //ensure iterator is not pointing to null, head, or tail
-    //Note: client can remove inactive node but would have no practical effect
-    //uses LinkOut and LinkIn to move link to after tail node
-    //Note: there will only be one case, since nodes aren't deleted
+    //precondition: i is at an active link [15]. An iterator on an unused link passes the
+    //checks below, since telling the two apart would walk the ring, but removing it
+    //corrupts size_ and excess_, and a later trim may then free active links.
     
     //Deal with impossible cases first
     if (i.curr_ == nullptr || i.curr_ == head_ || i.curr_ == tail_)
@@ -366,17 +743,23 @@ ListIterator<T> List<T>::Remove (ListIterator<T> i)
         std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
         return i;
     }
-    i.curr_ = i.curr_->next_; //advance iterator by one position
-    Link * RemovedLink = LinkOut(i.curr_->prev_); //get address of Removed link, remove it from list
-    LinkIn(tail_->next_, RemovedLink); //insert the removed link after the tail
+    index_.LinkingOut(i.curr_);
+    i.curr_ = Next(i.curr_); //advance iterator by one position
+    i.rev_ = reversed_;
+    Link * RemovedLink = LinkOut(Prev(i.curr_)); //get address of Removed link, remove it from list
+    LinkIn(Next(tail_), RemovedLink); //insert the removed link after the tail
+    Vacate(RemovedLink, Next(RemovedLink));
+    --size_;
+    ++excess_;
+    i.curr_ = Retain(i.curr_); //i is active or End(), so no trim frees it, but a compaction moves it
     return i; //return address of link after removed link
 }
 
 
 
-//const version of Remove
-template < typename T >
-ConstListIterator<T> List<T>::Remove (ConstListIterator<T> i)
+//const version of Remove; same precondition
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::Remove (ConstListIterator<T,I,A,R> i)
 {
     //Deal with impossible cases first
     if (i.curr_ == nullptr || i.curr_ == head_ || i.curr_ == tail_)
@@ -384,118 +767,213 @@ ConstListIterator<T> List<T>::Remove (ConstListIterator<T> i)
         std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
         return i;
     }
-    i.curr = i.curr_->next_; //advance iterator by one position
-    Link * RemovedLink = LinkOut(i.curr_->prev_); //get address of Removed link, remove it from list
-    LinkIn(tail_->next_, RemovedLink); //insert the removed link after the tail
+    index_.LinkingOut(i.curr_);
+    i.curr_ = Next(i.curr_); //advance iterator by one position
+    i.rev_ = reversed_;
+    Link * RemovedLink = LinkOut(Prev(i.curr_)); //get address of Removed link, remove it from list
+    LinkIn(Next(tail_), RemovedLink); //insert the removed link after the tail
+    Vacate(RemovedLink, Next(RemovedLink));
+    --size_;
+    ++excess_;
+    i.curr_ = Retain(i.curr_); //i is active or End(), so no trim frees it, but a compaction moves it
     return i; //return address of link after removed link
 }
 
 //Removes all copies of t, and returns the number of items removed
-template < typename T >
-size_t List<T>::Remove (const T &t)
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::Remove (const T &t)
 {
-    //start iterator at beginning of list
+    //find the first copy, sequentially or through the index
     size_t count(0);
-    Iterator i = Begin();
-    while (i != End())
+    Link * link = Find(Next(head_), t);
+    while (link != tail_)
     {
-        if (t == *i)
-        {
-            i = Remove(i); //remove link at i, then return address of following link
-            ++count;
-        }
-        else
-        {
-            ++i;
-        }
+        Iterator i = Remove(Iterator(link, reversed_)); //remove link, then return address of following link
+        ++count;
+        link = Find(i.curr_, t);
     }
     return count;
 }
 
 //Clear - makes the list empty  -- note: this does not actually de-allocate the memory; release is needed for that.
-template < typename T >
-void List<T>::Clear()
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Clear()
 {
+    Vacate(Next(head_), tail_);
     T tailValue = tail_->Tval_;
-    tail_ = head_->next_; //set the tail node to be the node right after the head
+    tail_ = Next(head_); //set the tail node to be the node right after the head
     tail_->Tval_ = tailValue; //preserves the tail's value (for dump purposes)
+    excess_ += size_; //every formerly active link is now unused
+    size_ = 0;
+    index_.Rebuild(First(),Last()); //empties the index
 }
 
 
 //De-allocate entire list.  Method is used in List<T> destructor.
-template < typename T >
-void List<T>::Release()
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Release()
 {
     Clear(); //makes the head and tail adjacent
     
-    
-    //Delete every node except the head and tail node.
-    Link * tmpLocation = tail_->next_;  //this is the issue, will have value of first in list
-    
-    while (tmpLocation != head_)
-    {
-        Link * tmpLocation2 = tmpLocation->next_;
-        delete tmpLocation;
-        tmpLocation = tmpLocation2;
-    }
-    //the head and tail nodes still remain; re link them
-    head_->prev_ = tail_;
-    head_->next_ = tail_;
-    tail_->next_ = head_;
-    tail_->prev_ = head_;
+    //Delete every node except the head and tail node; if they hold blocks that the
+    //others came from, the ring is compacted into a block of its own
+    ShrinkToFit(0);
 } // end release
 
-//Returns the active size of the array
-template < typename T >
-size_t List<T>::Size() const
+//Reserve - adds unused links after the tail until there are at least n of them; a spare
+//link holds T() until a push or insert refills it. Links added before a failure stay.
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::Reserve(size_t n)
+{
+    if (excess_ >= n) return 1;
+    size_t need = n - excess_;
+    return AddSpares(need) == need;
+}
+
+//ShrinkToFit - de-allocates the unused links beyond keep, nearest the tail first, and
+//compacts the ring if the links freed leave their blocks held by the rest [4]
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::ShrinkToFit(size_t keep)
 {
-    size_t size(0); //initialize size variable
-    Link * curr(head_->next_); //get pointer to link after head node
-    while (curr != tail_) //while curr pointer is not at the tail node
+    size_t count = FreeSpares(keep);
+    Unpin(nullptr);
+    return count;
+}
+
+//FreeSpares - the freeing part of ShrinkToFit, which leaves the ring where it is
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::FreeSpares(size_t keep)
+{
+    size_t count(0);
+    while (excess_ > keep)
     {
-        curr = curr -> next_;
-        ++size;
+        DeleteLink(LinkOut(Next(tail_)));
+        --excess_;
+        ++count;
     }
-    return size;
+    return count;
 }
 
-template < typename T >
-size_t List<T>::Excess() const
+//KeepSpareValues - whether unused links keep the values they last held; when turned off,
+//the values already held by the unused links and the head and tail are reset at once
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::KeepSpareValues(bool keep)
 {
-    size_t excess(0); //initialize excess variable
-    Link * curr(tail_->next_); //get pointer to link after tail node
-    while (curr != head_) //while curr pointer is not at the head node
+    keepValues_ = keep;
+    if (!keep)
     {
-        curr = curr -> next_;
-        ++excess;
+        Vacate(Next(tail_), head_); //the unused links
+        head_->Tval_ = T();
+        tail_->Tval_ = T();
     }
-    return excess;
+}
+
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::KeepsSpareValues() const
+{
+    return keepValues_;
+}
+
+//Retention - the list's own retention policy object
+template < typename T , class I , class A , class R >
+R& List<T,I,A,R>::Retention()
+{
+    return retain_;
+}
+
+template < typename T , class I , class A , class R >
+const R& List<T,I,A,R>::Retention() const
+{
+    return retain_;
+}
+
+//Returns the active size of the array; size_ is maintained by the mutators
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::Size() const
+{
+    return size_;
+}
+
+//Returns the number of unused links in the ring; excess_ is maintained by the mutators
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::Excess() const
+{
+    return excess_;
 }
 
 //Returns total capacity of the ring
-template < typename T >
-size_t List<T>::Capacity() const
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::Capacity() const
 {
-    return Size() + Excess();
+    return size_ + excess_;
 }
 
 //Determines if the list is empty
-template < typename T >
-bool List<T>::Empty () const
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::Empty () const
 {
-    return head_->next_ == tail_;
+    return Next(head_) == tail_;
 }
 
 //Determines if the list is full
-template < typename T >
-bool List<T>::Full () const
+template < typename T , class I , class A , class R >
+bool List<T,I,A,R>::Full () const
 {
-    return tail_->next_ == head_;
+    return Next(tail_) == head_;
+}
+
+//Reports the links, spare links and bytes held by the ring
+template < typename T , class I , class A , class R >
+fsu::ListStats List<T,I,A,R>::Stats () const
+{
+    fsu::ListStats s;
+    s.elements    = size_;
+    s.links       = size_;
+    s.spares      = excess_;
+    s.sentinels   = 2;
+    // each link of the ring is charged its share of the block it came from, so that the
+    // slots freed from blocks still held count, and a block shared with another list after
+    // a Merge or Splice is split between the two [4]
+    double slots = 0;
+    const Link * link = head_;
+    do
+    {
+        slots += link->block_ ? double(link->block_->size_ + 1) / link->block_->links_ : 1;
+        link = link->next_;
+    }
+    while (link != head_);
+    s.linkBytes   = static_cast<size_t>(slots * sizeof(Link) + 0.5);
+    s.objectBytes = sizeof(*this);
+    s.indexBytes  = index_.Bytes(First(),Last());
+    s.sparesKeepValues = keepValues_;
+    if (fsu::PayloadBytes<T>::deep)
+    {
+        // unused links and the sentinels hold the values they last held, or T()
+        link = head_;
+        do
+        {
+            s.payloadBytes += fsu::PayloadBytes<T>::Bytes(link->Tval_);
+            link = link->next_;
+        }
+        while (link != head_);
+        size_t active = 0;
+        for (link = First()->next_; link != Last(); link = link->next_)
+            active += fsu::PayloadBytes<T>::Bytes(link->Tval_);
+        s.retainedBytes = s.payloadBytes - active;
+    }
+    return s;
+}
+
+//Returns the total bytes held by the ring
+template < typename T , class I , class A , class R >
+size_t List<T,I,A,R>::MemoryUsage () const
+{
+    return Stats().Bytes();
 }
 
 //Access the front element on the list
-template < typename T >
-T& List<T>::Front ()
+template < typename T , class I , class A , class R >
+T& List<T,I,A,R>::Front ()
 {
     if(Empty())
     {
@@ -505,8 +983,8 @@ T& List<T>::Front ()
 }
 
 //Constant version of Front
-template < typename T >
-const T& List<T>::Front () const
+template < typename T , class I , class A , class R >
+const T& List<T,I,A,R>::Front () const
 {
     if(Empty())
     {
@@ -516,8 +994,8 @@ const T& List<T>::Front () const
 }
 
 //Access the back element on the list
-template < typename T >
-T& List<T>::Back ()
+template < typename T , class I , class A , class R >
+T& List<T,I,A,R>::Back ()
 {
     if (Empty())
     {
@@ -527,8 +1005,8 @@ T& List<T>::Back ()
 }
 
 //Constant version of back
-template < typename T >
-const T& List<T>::Back () const
+template < typename T , class I , class A , class R >
+const T& List<T,I,A,R>::Back () const
 {
     if (Empty())
     {
@@ -546,8 +1024,8 @@ const T& List<T>::Back () const
 // -- Generic Display Methods
 
 // Display the List (with no "dark side" elements or head and tail nodes)
-template < typename T >
-void List<T>::Display (std::ostream& os, char ofc) const
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Display (std::ostream& os, char ofc) const
 {
     ConstIterator i; //declare an iterator
     if (ofc == '\0')
@@ -559,8 +1037,8 @@ void List<T>::Display (std::ostream& os, char ofc) const
 } // end Display
 
 // Display the List in its entire structure including non-active nodes and head and tail nodes
-template < typename T >
-void List<T>::Dump (std::ostream& os, char ofc) const
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Dump (std::ostream& os, char ofc) const
 {
     ConstIterator i = Begin(); //declear an iterator that points to first element
     if (ofc == '\0')
@@ -585,8 +1063,8 @@ void List<T>::Dump (std::ostream& os, char ofc) const
 } // end Dump
 
 // structural integrity check - adopted from list2c.api file
-template < typename T >
-void List<T>::CheckLinks (std::ostream& os) const
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::CheckLinks (std::ostream& os) const
 {
     Link * q, * p = head_;
     size_t n = 0;
@@ -610,13 +1088,14 @@ void List<T>::CheckLinks (std::ostream& os) const
     {
         os << " ** link count mismatch: count = " << n << " , size = " << Size() << " , excess = " << Excess() << '\n';
     }
+    index_.Check(First(), Last(), os);
 }
 
 // structural integrity check - CheckIterators - adopted from list2c.api file
-template < typename T >
-void List<T>::CheckIters(std::ostream& os) const
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::CheckIters(std::ostream& os) const
 {
-    typename List<T>::ConstIterator i,j,k;
+    typename List<T,I,A,R>::ConstIterator i,j,k;
     // bool ok = 1;
     size_t n = 0;
     for (i = this->Begin(), n = 0; i != this->End(); ++i, ++n)
@@ -661,95 +1140,85 @@ void List<T>::CheckIters(std::ostream& os) const
 //--Iterator support--
 
 //Returns iterator pointed to first link after the head
-template < typename T >
-ListIterator<T> List<T>::Begin ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Begin ()
 {
-    Iterator i(head_->next_);
+    Iterator i(Next(head_), reversed_);
     return i;
 }
 
 //Returns iterator pointed to "1 past the back" ie the tail node
-template < typename T >
-ListIterator<T> List<T>::End ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::End ()
 {
-    Iterator i(tail_);
+    Iterator i(tail_, reversed_);
     return i;
 }
 
 //Returns iterator to the back (last link before tail node)
-template < typename T >
-ListIterator<T> List<T>::rBegin ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::rBegin ()
 {
-    Iterator i(tail_->prev_);
+    Iterator i(Prev(tail_), reversed_);
     return i;
 }
 
 //Returns iterator pointing to "1 past the front" ie the head node
-template < typename T >
-ListIterator<T> List<T>::rEnd ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::rEnd ()
 {
-    Iterator i(head_);
+    Iterator i(head_, reversed_);
     return i;
 }
 
 //Returns position of the first occurrence of t, or End()
-template < typename T >
-ListIterator<T> List<T>::Includes (const T &t)
+//with a hashed index, the position of some occurrence of t
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> List<T,I,A,R>::Includes (const T &t)
 {
-    //Note - the algorithm uses sequential search
-    Iterator i; //declare iterator
-    for (i = Begin(); i != End(); ++i)
-    {
-        if (t == *i)
-            return i;
-    }
-    return End();
+    //Note - the algorithm uses sequential search, or the index
+    return Iterator(Find(Next(head_), t), reversed_);
 }
 
 //Returns iterator pointed to first link after the head - constant version
-template < typename T >
-ConstListIterator<T> List<T>::Begin () const
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::Begin () const
 {
-    Iterator i(head_->next_);
+    Iterator i(Next(head_), reversed_);
     return i;
 }
 
 //Returns iterator pointed to "1 past the back" ie the tail node - constant version
-template < typename T >
-ConstListIterator<T> List<T>::End () const
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::End () const
 {
-    Iterator i(tail_);
+    Iterator i(tail_, reversed_);
     return i;
 }
 
 //Returns iterator to the back (last link before tail node) - constant version
-template < typename T >
-ConstListIterator<T> List<T>::rBegin () const
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::rBegin () const
 {
-    Iterator i(tail_->prev_);
+    Iterator i(Prev(tail_), reversed_);
     return i;
 }
 
 //Returns iterator pointing to "1 past the front" ie the head node - constant version
-template < typename T >
-ConstListIterator<T> List<T>::rEnd () const
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::rEnd () const
 {
-    Iterator i(head_);
+    Iterator i(head_, reversed_);
     return i;
 }
 
 //Returns position of the first occurrence of t, or End() - constant version
-template < typename T >
-ConstListIterator<T> List<T>::Includes (const T &t) const
+//with a hashed index, the position of some occurrence of t
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> List<T,I,A,R>::Includes (const T &t) const
 {
-    //Note - the algorithm uses sequential search
-    Iterator i; //declare iterator
-    for (i = Begin(); i != End(); ++i)
-    {
-        if (t == *i)
-            return i;
-    }
-    return End();
+    //Note - the algorithm uses sequential search, or the index
+    return ConstIterator(Find(Next(head_), t), reversed_);
 }
 
 // -- End Iterator Support
@@ -761,33 +1230,34 @@ ConstListIterator<T> List<T>::Includes (const T &t) const
 // -- ConstListIterator<T>::Implementations
 
 // default constructor - can be called by client programs
-template < typename T >
-ConstListIterator<T>::ConstListIterator() : curr_(nullptr)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>::ConstListIterator() : curr_(nullptr), rev_(0)
 {}
 
 // protected constructor - create an iterator around a Link pointer; not available to client programs
-template < typename T >
-ConstListIterator<T>::ConstListIterator (typename List<T>::Link * link) : curr_(link)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>::ConstListIterator (typename List<T,I,A,R>::Link * link, bool rev) : curr_(link), rev_(rev)
 {}
 
 // copy constructor - copies the iterator
-template < typename T >
-ConstListIterator<T>::ConstListIterator (const ConstListIterator<T>& i)
-:  curr_(i.curr_)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>::ConstListIterator (const ConstListIterator<T,I,A,R>& i)
+:  curr_(i.curr_), rev_(i.rev_)
 {}
 
 // assignment operator
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator = (const ConstListIterator <T> & i)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>& ConstListIterator<T,I,A,R>::operator = (const ConstListIterator <T,I,A,R> & i)
 {
     curr_ = i.curr_;  //note - no risk involved in self-assignment
+    rev_ = i.rev_;
     return *this;
 }
 
 // protected method - returns a refernece to the current T value the iterator is pointing to.  Note that this
 // method is used by both the const and non const versions.
-template < typename T >
-T&  ConstListIterator<T>::Retrieve() const
+template < typename T , class I , class A , class R >
+T&  ConstListIterator<T,I,A,R>::Retrieve() const
 {
     if (curr_ == nullptr)
     {
@@ -798,15 +1268,15 @@ T&  ConstListIterator<T>::Retrieve() const
 }
 
 // determine if the Iterator's pointer is valid or not
-template < typename T >
-bool ConstListIterator<T>::Valid() const
+template < typename T , class I , class A , class R >
+bool ConstListIterator<T,I,A,R>::Valid() const
 {
     return curr_ != nullptr;
 }
 
 // determine if two iterators are equivalnet; that is, if they're pointing to the same link
-template < typename T >
-bool ConstListIterator<T>::operator == (const ConstListIterator<T>& i2) const
+template < typename T , class I , class A , class R >
+bool ConstListIterator<T,I,A,R>::operator == (const ConstListIterator<T,I,A,R>& i2) const
 {
     if (curr_ == i2.curr_)
         return 1;
@@ -814,51 +1284,51 @@ bool ConstListIterator<T>::operator == (const ConstListIterator<T>& i2) const
 }
 
 // determine if two iterators are not equivalent
-template < typename T >
-bool ConstListIterator<T>::operator != (const ConstListIterator<T>& i2) const
+template < typename T , class I , class A , class R >
+bool ConstListIterator<T,I,A,R>::operator != (const ConstListIterator<T,I,A,R>& i2) const
 {
     return !(*this == i2);
 }
 
 // returns dereferneced iterator value (the T value)
-template < typename T >
-const T&  ConstListIterator<T>::operator * () const
+template < typename T , class I , class A , class R >
+const T&  ConstListIterator<T,I,A,R>::operator * () const
 {
     return Retrieve();
 }
 
 // prefix increment
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator ++ ()
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>& ConstListIterator<T,I,A,R>::operator ++ ()
 {
     if (curr_ != nullptr)
-        curr_ = curr_->next_;
+        curr_ = rev_ ? curr_->prev_ : curr_->next_; //a reversed list runs along prev_
     return *this;
 }
 
 // postfix increment
-template < typename T >
-ConstListIterator<T> ConstListIterator<T>::operator ++ (int)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> ConstListIterator<T,I,A,R>::operator ++ (int)
 {
-    ConstListIterator <T> clone = *this; //set temporary clone iterator to *this
+    ConstListIterator <T,I,A,R> clone = *this; //set temporary clone iterator to *this
     this->operator++(); //increment *this
     return clone; //return the clone (contains value before it was incremented)
 }
 
 // prefix decrement
-template < typename T >
-ConstListIterator<T>& ConstListIterator<T>::operator -- ()
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R>& ConstListIterator<T,I,A,R>::operator -- ()
 {
     if (curr_ != nullptr)
-        curr_ = curr_->prev_;
+        curr_ = rev_ ? curr_->next_ : curr_->prev_;
     return *this;
 }
 
 // postfix decrement
-template < typename T >
-ConstListIterator<T> ConstListIterator<T>::operator -- (int)
+template < typename T , class I , class A , class R >
+ConstListIterator<T,I,A,R> ConstListIterator<T,I,A,R>::operator -- (int)
 {
-    ConstListIterator <T> clone = *this; //set temporary clone iterator to *this
+    ConstListIterator <T,I,A,R> clone = *this; //set temporary clone iterator to *this
     this->operator--(); //decrement *this
     return clone; //return the clone (contains value before it was decremented)
 }
@@ -872,73 +1342,73 @@ ConstListIterator<T> ConstListIterator<T>::operator -- (int)
 // -- ListIterator<T> Implementations
 
 // default constructor -- can be called by client programs; creates a null list iterator
-template < typename T >
-ListIterator<T>::ListIterator () : ConstListIterator<T>() //inherits from ConstListIterator
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>::ListIterator () : ConstListIterator<T,I,A,R>() //inherits from ConstListIterator
 {}
 
 // protected constructor - constructs iterator based on pointer to link; not avaialble to client
-template < typename T >
-ListIterator<T>::ListIterator (typename List<T>::Link * link) : ConstListIterator<T> (link)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>::ListIterator (typename List<T,I,A,R>::Link * link, bool rev) : ConstListIterator<T,I,A,R> (link, rev)
 {}
 
 // copy constructor
-template < typename T >
-ListIterator<T>::ListIterator (const ListIterator<T>& i)
-:  ConstListIterator<T>(i)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>::ListIterator (const ListIterator<T,I,A,R>& i)
+:  ConstListIterator<T,I,A,R>(i)
 {}
 
 // assignment operator
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator = (const ListIterator <T> & i)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>& ListIterator<T,I,A,R>::operator = (const ListIterator <T,I,A,R> & i)
 {
-    ConstListIterator<T>::operator=(i);
+    ConstListIterator<T,I,A,R>::operator=(i);
     return *this;
 }
 
 // dereference operator -- uses same retrieve as ConstListIterator, for use on const objects
-template < typename T >
-const T&  ListIterator<T>::operator * () const
+template < typename T , class I , class A , class R >
+const T&  ListIterator<T,I,A,R>::operator * () const
 {
-    return ConstListIterator<T>::Retrieve();
+    return ConstListIterator<T,I,A,R>::Retrieve();
 }
 
 // deference operator for use on non-const data objects (note - can use reference to change value)
-template < typename T >
-T&  ListIterator<T>::operator * ()
+template < typename T , class I , class A , class R >
+T&  ListIterator<T,I,A,R>::operator * ()
 {
-    return ConstListIterator<T>::Retrieve();
+    return ConstListIterator<T,I,A,R>::Retrieve();
 }
 
 // prefix increment - same as Const
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator ++ ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>& ListIterator<T,I,A,R>::operator ++ ()
 {
-    ConstListIterator<T>::operator++();
+    ConstListIterator<T,I,A,R>::operator++();
     return *this;
 }
 
 // postfix increment - same as Const
-template < typename T >
-ListIterator<T> ListIterator<T>::operator ++ (int)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> ListIterator<T,I,A,R>::operator ++ (int)
 {
-    ListIterator <T> clone = *this;
+    ListIterator <T,I,A,R> clone = *this;
     this->operator++();
     return clone;
 }
 
 // prefix decrement - same as Const
-template < typename T >
-ListIterator<T>& ListIterator<T>::operator -- ()
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R>& ListIterator<T,I,A,R>::operator -- ()
 {
-    ConstListIterator<T>::operator--();
+    ConstListIterator<T,I,A,R>::operator--();
     return *this;
 }
 
 // postfix decrement - same as Const
-template < typename T >
-ListIterator<T> ListIterator<T>::operator -- (int)
+template < typename T , class I , class A , class R >
+ListIterator<T,I,A,R> ListIterator<T,I,A,R>::operator -- (int)
 {
-    ListIterator <T> clone = *this;
+    ListIterator <T,I,A,R> clone = *this;
     this->operator--();
     return clone;
 }
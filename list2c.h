@@ -15,7 +15,7 @@
     "surround" the active links in the list; the unused node is then moved to the tail.
 
     The only time that new links are added to the list is if the ring is full; that is, there
-    is no excess link as defined by the Excess() method.
+    is no excess link as defined by the Excess() method, or when Reserve(n) asks for them [4].
  
     Note the following (from assignment requirements API):
  
@@ -23,6 +23,14 @@
     - Pop Front/Back advances/retreats the head/tail pointer
     - Insert(i,t) uses tail_ link if available
     - Remove(i) stores old link at tail_
+
+    The template arguments after T are policies, each with a default that costs nothing:
+
+      alt2c::List < T , I = fsu::NoIndex , A = std::allocator<T> , R = alt2c::KeepAll >
+
+    I indexes the active links (linkindex.h) [2], A allocates every link of the ring [3],
+    and R decides how many unused links the ring keeps (retention.h) [5]. Numbers in square
+    brackets refer to the notes at the end of this file.
 */
 
 #ifndef _LIST_H
@@ -30,33 +38,45 @@
 
 #include <iostream>    // class ostream and objects cerr, cout
 #include <cstdlib>     // EXIT_FAILURE, size_t
+#include <utility>     // std::move, std::forward, std::swap
+#include <memory>      // std::allocator, std::allocator_traits
 #include <compare.h>   // needed for Sort()
+#include <linkindex.h> // index policies fsu::NoIndex, fsu::HashIndex
+#include <liststats.h> // fsu::ListStats, fsu::PayloadBytes
+#include <type_traits> // std::is_same
+#include <xran.h>      // fsu::RandomBase, for Shuffle(ran)
+#include <retention.h> // retention policies alt2c::KeepAll, FractionRetention, DecayRetention
 
 namespace alt2c //required to resolve the type of list being used, as opposed to fsu::List
 {
 
-  template < typename T >
+  template < typename T , class I = fsu::NoIndex , class A = std::allocator<T> , class R = KeepAll >
   class List;
 
-  template < typename T >
+  template < typename T , class I = fsu::NoIndex , class A = std::allocator<T> , class R = KeepAll >
   class ConstListIterator;
 
-  template < typename T >
+  template < typename T , class I = fsu::NoIndex , class A = std::allocator<T> , class R = KeepAll >
   class ListIterator;
 
   //----------------------------------
   //     List<T>
   //----------------------------------
 
-  template < typename T >
+  template < typename T , class I , class A , class R >
   class List
   {
+    // the ring has no nullptr ends to stop a skip list
+    static_assert(!std::is_same < I , fsu::SkipIndex > ::value, "alt2c::List cannot use fsu::SkipIndex");
+
   public:
     //definition support for clients; clients can simply type List<T>::Iterator to get
     //an iterator object appropriate for the list.
     typedef T                                      ValueType;
-    typedef ListIterator < T >                     Iterator;
-    typedef ConstListIterator < T >                ConstIterator;
+    typedef ListIterator < T , I , A , R >         Iterator;
+    typedef ConstListIterator < T , I , A , R >    ConstIterator;
+    typedef A                                      AllocatorType;
+    typedef R                                      RetentionType;
     //for adapters, could say
     // typedef ConstRAIterator< ListIterator<T> >   ConstIterator;
       // friend class ConstRAIterator
@@ -64,9 +84,12 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
     // constructors and assignment
                    List       ();              // default constructor
                    List       (T fill);        // development constructor
+    explicit       List       (const A& alloc); // links allocated by a copy of alloc [3]
     virtual        ~List      ();              // destructor
                    List       (const List& );  // copy constructor
+                   List       (List&& );       // move constructor; argument left empty
     List&          operator = (const List& );  // assignment
+    List&          operator = (List&& );       // move assignment; exchanges rings
     virtual List * Clone      () const;        // returns ptr to deep copy of this list [13]
 
     // modifying List structure - mutators
@@ -77,6 +100,18 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
     Iterator  Insert     (const T& t);   // Insert t
     List&     operator+= (const List& list); // append list
 
+    // move and in-place versions of the inserting mutators; a new link is built in place,
+    // a reused ring link has its value replaced by T(args...)
+    bool      PushFront  (T&& t);
+    bool      PushBack   (T&& t);
+    Iterator  Insert     (Iterator i, T&& t);
+    template < class... Args >
+    bool      EmplaceFront (Args&&... args);  // construct T(args...) at front
+    template < class... Args >
+    bool      EmplaceBack  (Args&&... args);  // construct T(args...) at back
+    template < class... Args >
+    Iterator  Emplace      (Iterator i, Args&&... args); // construct T(args...) at i
+
     bool      PopFront  ();              // Remove the Tval at front
     bool      PopBack   ();              // Remove the Tval at back 
     Iterator  Remove    (Iterator i);    // Remove item at I
@@ -84,18 +119,36 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
     size_t    Remove    (const T& t);    // Remove all copies of t
     void      Clear     ();              // make list empty
     void      Release   ();              // de-allocate all memory except head and tail nodes
+    bool      Reserve   (size_t n);      // at least n unused links; false if out of memory [4]
+    size_t    ShrinkToFit (size_t keep = 0); // free unused links beyond keep; returns number freed [4]
+    R&        Retention ();              // the retention policy of this list and its counts [5]
+    const R&  Retention () const;
+    void      KeepSpareValues  (bool keep); // true (default): unused links keep their values [6]
+    bool      KeepsSpareValues () const;
 
     // macroscopic (whole list) mutators
     void      Sort      ();               // default order <
-    void      Merge     (List<T>& list);  // merges "list" into this list
-    void      Reverse   ();
-    void      Shuffle   ();
+    void      Merge     (List<T,I,A,R>& list);  // merges "list" into this list
+    void      MergeAll  (List<T,I,A,R>* lists[], size_t k); // merges k lists in one pass [10]
+    void      Reverse   ();               // constant time: the list changes direction [8]
+    void      ReverseLinks ();            // reverses prev_ and next_ of every link in the ring
+    void      Shuffle   ();               // fixed permutation, the same every time
+    void      Shuffle   (fsu::RandomBase& ran); // uniform random order of the active links [9]
+    void      Shuffle   (uint64_t seed);  // the same, drawn from a RandomBase seeded with seed
+
+    // moving active links between lists without copying elements [11]
+    void      Splice    (Iterator pos, List<T,I,A,R>& list);             // all of list, ahead of pos
+    void      Splice    (Iterator pos, List<T,I,A,R>& list, Iterator i); // element i of list
+    void      Splice    (Iterator pos, List<T,I,A,R>& list, Iterator first, Iterator last); // [first,last)
 
     template < class Predicate > // Predicate object used to determine order
     void      Sort      (Predicate& p);
 
     template < class Predicate > // Predicate object used to determine order
-    void      Merge     (List<T>& list, Predicate& p);
+    void      Merge     (List<T,I,A,R>& list, Predicate& p);
+
+    template < class Predicate > // all lists in order p; ties go to this list, then lists in index order
+    void      MergeAll  (List<T,I,A,R>* lists[], size_t k, Predicate& p);
 
     // information about the list - accessors [15]
     size_t    Size     () const;  // return the number of elements on the list
@@ -104,6 +157,10 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
     bool      Empty    () const;
     bool      Full     () const;
 
+    // memory held by the ring, unused links included [7]
+    fsu::ListStats Stats       () const;
+    size_t         MemoryUsage () const;  // Stats().Bytes()
+
     // accessing values on the list - more accessors
     T&        Front ();        // return reference to Tval at front of list
     const T&  Front () const;  // const version
@@ -134,67 +191,115 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
 
    
   protected:
+    // a batch of links allocated at once: this header in the first Link slot, then the
+    // links; shared by the lists its links move to, and freed with its last link [4]
+    struct Block
+    {
+      size_t links_;  // links of the block not yet freed
+      size_t size_;   // links the block was allocated with
+    } ;
+
     // A scope List<T>:: class usable only by its friends (all members are private)
-    class Link
+    class Link : public I::Hook  // per-link data of the index [2]
     {
-      friend class List<T>;
-      friend class ConstListIterator<T>;
-      friend class ListIterator<T>;
+      friend class List<T,I,A,R>;
+      friend class ConstListIterator<T,I,A,R>;
+      friend class ListIterator<T,I,A,R>;
+      friend I;
+      template < class L , class P >
+      friend void SortLinks (L * head, L * tail, P& comp); // list_sort.cpp
+      template < class L , class P , class V >
+      friend void SortLinks (L * head, L * tail, P& comp, V value);
 
       // Link variables
       T       Tval_;        // data
       Link *  prev_;        // ptr to predecessor Link
       Link *  next_;        // ptr to successor Link
+      Block * block_;       // the batch the link was allocated in; nullptr for a link on its own
 
-      // Link constructor - parameter required
+      // Link constructors - parameter required
       Link(const T& );
+      template < class... Args >
+      Link(Args&&... args);  // constructs Tval_ in place
     } ; // end class list
 
     Link *  head_,  // node representing "one before the first"
          *  tail_;  // node representing "one past the last"
+    size_t  size_,  // number of active links, from head_->next_ to tail_->prev_
+            excess_,// number of unused links, from tail_->next_ to head_->prev_
+            pinned_;// links freed while their blocks were still held, since the last Compact [4]
+    bool    reversed_; // the list runs from head_ to tail_ along prev_; next_ is then "previous"
+    bool    keepValues_; // unused links keep the values they last held
+    I       index_; // index policy object; it covers the active links only
+    typename std::allocator_traits < A > ::template rebind_alloc < Link > alloc_; // allocator for every link
+    R       retain_; // retention policy for the unused links
 
     // protected methods -- used only by other methods
     void Init   ();                 // sets up head and tail nodes
     void Init   (T fill);           // development version - makes links visible under Dump
     void Append (const List& list); // append deep copy of list
 
-    // protected method isolates memory allocation and associated exception handling
-    static Link * NewLink (const T&);
+    // protected methods isolate memory allocation and associated exception handling
+    template < class... Args >
+    Link * NewLink    (Args&&... args);
+    Link * NewBlock   (size_t n);  // n links of T() in one allocation, chained from the first
+    void   DeleteLink (Link * oldLink);
+    Link * Retain     (Link * link = nullptr); // frees the unused links retain_ gives up, after a removal
+    size_t FreeSpares (size_t keep); // frees the unused links beyond keep, nearest the tail first
+    Link * Unpin      (Link * link); // compacts the ring when freed links pin too many blocks
+    Link * Compact    (Link * link); // moves the ring into one new block; returns where link went
+    bool   Grow       ();  // adds the batch of unused links retain_ advises, to a full ring
+    size_t AddSpares  (size_t n); // allocates up to n links as a block, splices them in after tail_
+    void   Vacate     (Link * first, Link * last); // [first,last) now unused: T() unless keepValues_
+
+    // protected methods give a reused ring link a new value
+    static void   Refill  (Link * link, const T& t);
+    static void   Refill  (Link * link, T&& t);
+    template < class... Args >
+    static void   Refill  (Link * link, Args&&... args);
+
+    // the neighbours of a link in the direction of the list
+    Link *& Next (Link * link) const { return reversed_ ? link->prev_ : link->next_; }
+    Link *& Prev (Link * link) const { return reversed_ ? link->next_ : link->prev_; }
+    Link *  First () const { return reversed_ ? tail_ : head_; } // the active links run from
+    Link *  Last  () const { return reversed_ ? head_ : tail_; } // First() to Last() along next_
 
     // standard link-in and link-out processes
-    static void   LinkIn  (Link * location, Link * newLink);
-    static Link * LinkOut (Link * oldLink);
+    void          LinkIn   (Link * location, Link * newLink);
+    static Link * LinkOut  (Link * oldLink);
+    void          Transfer (Link * location, List& y, Link * first, Link * last); // [first,last) of y
+    Link *        Find     (Link * from, const T& t) const; // first at or after from holding t, or tail_
 
     // tight couplings
-    friend class ListIterator<T>;
-    friend class ConstListIterator<T>; // [1]
+    friend class ListIterator<T,I,A,R>;
+    friend class ConstListIterator<T,I,A,R>; // [1]
     // numbers in square brackets refer to notes at the end of this file
   } ; // end class List<T>
 
   // global scope operators and functions; this is required for output using cout
   // and also to ensure that lists may occur on either side of the equal sign.
 
-  template <typename T>
-  bool operator == (const List<T>& list1, const List<T>& list2);
+  template < typename T , class I , class A , class R >
+  bool operator == (const List<T,I,A,R>& list1, const List<T,I,A,R>& list2);
 
-  template <typename T>
-  bool operator != (const List<T>& list1, const List<T>& list2);
+  template < typename T , class I , class A , class R >
+  bool operator != (const List<T,I,A,R>& list1, const List<T,I,A,R>& list2);
 
-  template <typename T>
-  std::ostream& operator << (std::ostream& os, const List<T>& list);
+  template < typename T , class I , class A , class R >
+  std::ostream& operator << (std::ostream& os, const List<T,I,A,R>& list);
 
   //----------------------------------
   //     ConstListIterator<T>
   //----------------------------------
 
-  template <typename T>
+  template < typename T , class I , class A , class R >
   class ConstListIterator
   {
   public:
     // terminology support
     typedef T                                      ValueType;
-    typedef ConstListIterator < T >                ConstIterator;
-    typedef ListIterator < T >                     Iterator;
+    typedef ConstListIterator < T , I , A , R >                ConstIterator;
+    typedef ListIterator < T , I , A , R >                     Iterator;
 
     // constructors
     ConstListIterator       ();                          // default constructor
@@ -215,32 +320,33 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
 
   protected:
     // data
-    typename List<T>::Link * curr_;
+    typename List<T,I,A,R>::Link * curr_;
+    bool                         rev_;  // reversed_ of the list when the iterator was made [8]
 
     // methods
-    ConstListIterator (typename List<T>::Link * linkPtr); // type converting constructor
+    ConstListIterator (typename List<T,I,A,R>::Link * linkPtr, bool rev = 0); // type converting constructor
     T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
 
     // tight couplings
-    friend class List<T>;
+    friend class List<T,I,A,R>;
   } ;  //end class ConstListIterator<T>
 
   //----------------------------------
   //     ListIterator<T>
   //----------------------------------
 
-  template <typename T>
-  class ListIterator : public ConstListIterator<T>
+  template < typename T , class I , class A , class R >
+  class ListIterator : public ConstListIterator<T,I,A,R>
   {
   public:
     // terminology support
     typedef T                                      ValueType;
-    typedef ConstListIterator < T >                ConstIterator;
-    typedef ListIterator < T >                     Iterator;
+    typedef ConstListIterator < T , I , A , R >                ConstIterator;
+    typedef ListIterator < T , I , A , R >                     Iterator;
 
     // constructors
     ListIterator       ();                       // default constructor
-    ListIterator       (List<T>& );              // initializing constructor
+    ListIterator       (List<T,I,A,R>& );              // initializing constructor
     ListIterator       (const ListIterator& );   // copy constructor
 
     // information/access
@@ -259,11 +365,11 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
 
   protected:
     // methods
-    ListIterator (typename List<T>::Link * linkPtr); // type converting constructor
+    ListIterator (typename List<T,I,A,R>::Link * linkPtr, bool rev = 0); // type converting constructor
     // T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
 
     // tight couplings
-    friend class List<T>;
+    friend class List<T,I,A,R>;
   } ;  //end class ListIterator : public ConstListIterator<T>
 
 
@@ -275,6 +381,136 @@ namespace alt2c //required to resolve the type of list being used, as opposed to
     
 } // namespace alt2c
 
+/* Notes
+   =====
+
+[1] The classes List and ListIterator are mutual friends, which gives each
+    class access to the other's private and protected members. This feature
+    is called "tight coupling".
+
+[2] The second template argument is an index policy from linkindex.h, as
+    for fsu::List. The default fsu::NoIndex costs nothing. With
+    fsu::HashIndex<H>, for example
+
+      alt2c::List<T,fsu::HashIndex<std::hash<T>>> x;
+
+    Includes(t) and Remove(t) find copies of t by hash instead of walking
+    the list. Only the active links are indexed: a link enters the index
+    when a push or insert fills it, new or reused, and leaves it when a pop
+    or Remove moves it to the unused links. The whole-list mutators rebuild
+    the index. Values must not be changed through iterators, Front or Back
+    while indexed. fsu::SkipIndex needs nullptr ends and cannot be used.
+
+[3] The third template argument is a standard allocator for T, rebound to
+    Link and used for every link of the ring, head and tail included;
+    std::allocator<T> is the default. A stateful allocator is passed to the
+    constructor and is shared by copies and Clone [13].
+
+[4] A full ring gets a batch of links at once, chained and spliced in after
+    the tail in one step, so the pushes that follow refill links instead of
+    allocating. The retention policy sets the batch size [5]: under the
+    default it is Size()/2 + 1, so the ring grows by half, and a list grown
+    by n pushes makes about log1.5(n) allocator calls and holds at most
+    about n/2 unused links, even under KeepAll. Excess(), Capacity(),
+    Full() and Dump show the batch.
+
+    Reserve(n) allocates unused links up front, so that the next n pushes
+    or inserts take links from the ring and allocate nothing; a producer
+    that fills the list in bursts can pay for its links once, at startup.
+    ShrinkToFit(keep) gives back the unused links beyond keep after such a
+    burst and leaves the active ones alone.
+
+    A batch of more than one link is one block: a single allocation whose
+    first Link slot holds a count of the links not yet freed. DeleteLink
+    counts the block down and gives it back to the allocator with its last
+    link, and a link moved to another list in Merge or Splice takes its
+    block along; the allocators compare equal, so either list may free it.
+    A block the allocator refuses is halved.
+
+    A link freed by a trim or ShrinkToFit while other links of its block
+    live on gives no memory back, so the list counts such links. Once they
+    outnumber the links of the ring, the ring is compacted: its values,
+    head and tail included, move in ring order into one new block of the
+    exact size, and the old links are freed, which releases the blocks
+    they pinned. The blocks a list holds therefore stay within about twice
+    its ring, and a compaction costs no more than the frees that led to it.
+    A compaction moves every element, so a trim after a pop or Remove, and
+    ShrinkToFit or Release, may leave every iterator of the list dangling;
+    Remove(i) returns an iterator to the moved position. KeepAll never
+    trims, so under it only ShrinkToFit and Release compact. Blocks still
+    held by links that another list took in Merge or Splice stay until that
+    list frees them.
+
+    Stats() charges each link of the ring its share of its block, header
+    and freed slots included, so linkBytes is the memory of the blocks the
+    list holds, split by links with any list sharing them [7].
+
+[5] The fourth template argument is a retention policy from retention.h.
+    After each PopFront, PopBack and Remove the list asks it how many unused
+    links to free, and frees them in a batch from next to the tail; when the
+    ring is full it asks how many to add [4]. The default alt2c::KeepAll
+    frees none, so the ring keeps every link it has held.
+    alt2c::FractionRetention keeps unused links in proportion to Size().
+    alt2c::DecayRetention lets the ring shrink slowly after a spike.
+    Retention() gives the list's own policy object, to tune it or to read
+    its counts of links allocated, allocator calls and links trimmed.
+
+[6] An unused link keeps the value it last held. A String refilled with
+    one of the same length reuses its buffer, but every popped String holds
+    its buffer until the link is refilled or freed. KeepSpareValues(0) makes
+    the list reset a value to T() as its link leaves the active part of the
+    ring, in pops, Remove, Clear and a shrinking assignment, and resets the
+    unused links at once. Clear then takes linear time.
+    Stats().sparesKeepValues shows the mode in effect [7].
+
+[7] Stats() and MemoryUsage() report the memory of the whole ring: the
+    unused links are counted as spares, and since a link keeps its value
+    when it is moved to the unused links [6], the payload bytes of a String
+    list (fsu::PayloadBytes, liststats.h) are summed over every link of the
+    ring, head and tail included, not only the active ones. The part held
+    outside the active links is reported as retainedBytes. Stats() walks
+    the ring for linkBytes, the memory of the blocks its links came from [4].
+
+[8] Reverse() takes constant time: it swaps head_ and tail_ and flips
+    reversed_, and from then on the list treats prev_ as its "next"
+    pointer, as fsu::List does (list.h, note [23]). The ring is symmetric,
+    so the unused links stay between tail_ and head_ in the new direction.
+    An iterator copies the flag when it is made, so Reverse() invalidates
+    the iterators of the list, and a Merge or Splice between lists of
+    opposite direction flips the moved links, in linear time, and
+    invalidates the iterators to them [11]. ReverseLinks() reverses the
+    pointers of every link of the ring instead.
+
+[9] Shuffle(ran) puts the active links in a uniformly random order, as
+    fsu::List does (list.h, note [24]): one array of link pointers, a
+    Fisher-Yates pass and a relink. The unused links are not touched and no
+    element is copied. xran.cpp must be linked.
+
+[10] MergeAll(lists,k,p) merges this list and lists[0..k) in one pass with
+     a loser tree, O(n log k) comparisons, as fsu::List does (list.h, note
+     [26]). Lists whose allocator differs from this list's are reported and
+     left as they were; each list keeps its own unused links.
+
+[11] Merge and Splice move active links between lists without copying
+     elements; each list keeps its own unused links. They require the
+     allocators of the two lists to compare equal [3] and otherwise report
+     an error and do nothing. The range version of Splice counts
+     [first,last) to keep Size() exact.
+
+[13] Copies and Clone() share the allocator of the original and take a copy
+     of its retention policy and KeepSpareValues mode; the copy allocates
+     the links its elements need in one block, so it starts Full().
+     Assignment refills the links the target already has, allocates any
+     missing ones in one block, and asks the retention policy about the
+     links left unused when the target shrinks [5].
+
+[15] The number of active links (Size) and unused links (Excess) are kept
+     as counts that every mutator maintains, so Size(), Excess(),
+     Capacity() and Full() are constant time and pushes never walk the
+     ring. As a consequence Insert(i,t) and Remove(i) require i to be at an
+     active position (or End() for Insert); an iterator that has wandered
+     past End() or rEnd() onto the unused links is illegitimate for these
+     operations.
+*/
 
 #endif
-
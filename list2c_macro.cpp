@@ -4,69 +4,290 @@
     Chris Lacher
 
     Implementation of List<T>:: macroscopic (whole list) mutators
-    Merge, Reverse, Shuffle
+    Sort, Merge, MergeAll, Reverse, Shuffle, Splice
+
+    These relink many links at once, so they end by rebuilding the index
+    of each list involved rather than updating it link by link.
 
     Copyright 2016, R. C. Lacher
 */
 
+//----------------------------------
+//     List<T>::Sort Implementations
+//----------------------------------
+
+template < typename T , class I , class A , class R >
+template < class P >
+void List<T,I,A,R>::Sort (P& comp)
+// the links of the active part of the ring are sorted in place
+{
+  if (reversed_) // the active links run from tail_ to head_ along next_: sort them into the opposite order
+  {
+    auto flip = [&comp] (T& t1, T& t2) { return comp(t2,t1); };
+    SortLinks(tail_,head_,flip);
+  }
+  else
+    SortLinks(head_,tail_,comp);
+  index_.Rebuild(First(),Last());
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
 //-----------------------------------
 //     List<T>::Merge Implementations
 //-----------------------------------
 
-template < typename T >
+template < typename T , class I , class A , class R >
 template < class P >
-void List<T>::Merge (List<T>& y, P& p)
+void List<T,I,A,R>::Merge (List<T,I,A,R>& y, P& p)
 // merges x into this list; post: true = x.Empty()
 // if both lists are ordered result is ordered
 {
   if (this == &y) return;
-  Link * xcurr = head_->next_;   // x = this list
-  Link * ycurr = y.head_->next_; // y = that list
+  if (!(alloc_ == y.alloc_))
+  {
+    std::cerr << "** List error: Merge() called with lists of unequal allocators\n";
+    return;
+  }
+  Link * xcurr = Next(head_);     // x = this list
+  Link * ycurr = y.Next(y.head_); // y = that list
 
   // merge while both lists are not empty
   while (xcurr != tail_ && ycurr != y.tail_)
   {
     if (p(ycurr->Tval_,xcurr->Tval_)) // y < x
     {
-      ycurr = ycurr->next_;
-      LinkIn(xcurr,ycurr->prev_);
+      ycurr = y.Next(ycurr);
+      LinkIn(xcurr,y.Prev(ycurr)); // sets both pointers, so either direction of y will do
     }
     else // x <= y
     {
-      xcurr = xcurr->next_;
+      xcurr = Next(xcurr);
     }
   }
 
-  // splice in remainder of y
+  // splice in remainder of y, once y no longer refers to the links already moved
   if (ycurr != y.tail_)
   {
-    tail_->prev_->next_ = ycurr;
-    ycurr->prev_ = tail_->prev_;
-    tail_->prev_ = (y.tail_)->prev_;
-    (y.tail_)->prev_->next_ = tail_;
+    y.Next(y.head_) = ycurr;
+    y.Prev(ycurr) = y.head_;
+    Transfer(tail_,y,ycurr,y.tail_);
   }
 
   // make y structurally correct for empty
-  (y.head_)->next_ = y.tail_;
-  (y.tail_)->prev_ = y.head_;
+  y.Next(y.head_) = y.tail_;
+  y.Prev(y.tail_) = y.head_;
+
+  // all of y's elements now belong to this list; y keeps its unused links
+  size_ += y.size_;
+  y.size_ = 0;
+  index_.Rebuild(First(),Last());
+  y.index_.Rebuild(y.First(),y.Last());
 }
 
-template < typename T >
-void List<T>::Merge (List<T>& y )
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Merge (List<T,I,A,R>& y )
 {
   fsu::LessThan<T> p;
   Merge(y,p);
 }
 
+template < typename T , class I , class A , class R >
+template < class P >
+void List<T,I,A,R>::MergeAll (List<T,I,A,R>* lists[], size_t k, P& p)
+// k-way merge with a loser tree: src[0] is this list, src[1..m) the distinct
+// lists of lists[]; loser[n] is the source that lost the match at node n,
+// and the source w that won the whole tree gives the next link
+{
+  List ** src   = new(std::nothrow) List* [k + 1];
+  Link ** curr  = new(std::nothrow) Link* [k + 1];     // front link of each source
+  size_t * loser = new(std::nothrow) size_t [2 * (k + 1)]; // losers, then winners while building
+  if (src == nullptr || curr == nullptr || loser == nullptr)
+  {
+    delete [] src;
+    delete [] curr;
+    delete [] loser;
+    for (size_t j = 0; j < k; ++j) // the same order, with more comparisons
+      if (lists[j] != nullptr) Merge(*lists[j],p);
+    return;
+  }
+  size_t m = 0;
+  src[m++] = this;
+  for (size_t j = 0; j < k; ++j)
+  {
+    List * y = lists[j];
+    bool skip = (y == nullptr || y->Empty());
+    for (size_t i = 0; i < m && !skip; ++i)
+      skip = (src[i] == y);
+    if (skip) continue;
+    if (!(alloc_ == y->alloc_))
+    {
+      std::cerr << "** List error: MergeAll() called with lists of unequal allocators\n";
+      continue;
+    }
+    src[m++] = y;
+  }
+  for (size_t i = 0; i < m; ++i)
+    curr[i] = src[i]->Next(src[i]->head_);
+
+  // a beats b: a is not exhausted and its front comes first; ties go to the lower index
+  auto beats = [&] (size_t a, size_t b) -> bool
+  {
+    if (curr[b] == src[b]->tail_) return 1;
+    if (curr[a] == src[a]->tail_) return 0;
+    return a < b ? !p(curr[b]->Tval_,curr[a]->Tval_) : p(curr[a]->Tval_,curr[b]->Tval_);
+  };
+
+  // build the tree: nodes 1..m-1, leaf m+i for source i
+  size_t * win = loser + m;
+  for (size_t n = m - 1; n > 0; --n)
+  {
+    size_t l = 2 * n < m ? win[2 * n] : 2 * n - m;
+    size_t r = 2 * n + 1 < m ? win[2 * n + 1] : 2 * n + 1 - m;
+    if (beats(l,r)) { win[n] = l; loser[n] = r; }
+    else            { win[n] = r; loser[n] = l; }
+  }
+  size_t w = m > 1 ? win[1] : 0;
+
+  // take the front of the winner, then replay its path to the root;
+  // the unused links beyond tail_ are not touched
+  Link * prev = head_;
+  while (curr[w] != src[w]->tail_)
+  {
+    Link * link = curr[w];
+    curr[w] = src[w]->Next(link); // read before link is relinked
+    Next(prev) = link;
+    Prev(link) = prev;
+    prev = link;
+    for (size_t n = (w + m) / 2; n > 0; n /= 2)
+      if (beats(loser[n],w))
+        std::swap(loser[n],w);
+  }
+  Next(prev) = tail_;
+  Prev(tail_) = prev;
+
+  // all active links now belong to this list; each y keeps its unused links
+  for (size_t i = 1; i < m; ++i)
+  {
+    List * y = src[i];
+    y->Next(y->head_) = y->tail_;
+    y->Prev(y->tail_) = y->head_;
+    size_ += y->size_;
+    y->size_ = 0;
+    y->index_.Rebuild(y->First(),y->Last());
+  }
+  index_.Rebuild(First(),Last());
+  delete [] src;
+  delete [] curr;
+  delete [] loser;
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::MergeAll (List<T,I,A,R>* lists[], size_t k)
+{
+  fsu::LessThan<T> p;
+  MergeAll(lists,k,p);
+}
+
+//------------------------------------
+//     List<T>::Splice Implementations
+//------------------------------------
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Splice (Iterator pos, List<T,I,A,R>& y)
+// moves all active links of y ahead of pos; post: y.Empty(), y keeps its unused links
+{
+  if (this == &y || y.Next(y.head_) == y.tail_) return;
+  if (!(alloc_ == y.alloc_))
+  {
+    std::cerr << "** List error: Splice() called with lists of unequal allocators\n";
+    return;
+  }
+  if (!pos.Valid() || pos.curr_ == head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid position\n";
+    return;
+  }
+  Transfer(pos.curr_,y,y.Next(y.head_),y.tail_);
+  size_ += y.size_;
+  y.size_ = 0;
+  index_.Rebuild(First(),Last());
+  y.index_.Rebuild(y.First(),y.Last());
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Splice (Iterator pos, List<T,I,A,R>& y, Iterator i)
+// moves the element at i in y ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == head_ || !i.Valid() || i.curr_ == y.head_ || i.curr_ == y.tail_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (pos.curr_ == i.curr_ || pos.curr_ == y.Next(i.curr_)) return; // already in place
+  if (this != &y && !(alloc_ == y.alloc_))
+  {
+    std::cerr << "** List error: Splice() called with lists of unequal allocators\n";
+    return;
+  }
+  y.index_.LinkingOut(i.curr_); // one link: the indexes are updated, not rebuilt
+  Transfer(pos.curr_,y,i.curr_,y.Next(i.curr_));
+  index_.LinkedIn(i.curr_);
+  ++size_;
+  --y.size_;
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Splice (Iterator pos, List<T,I,A,R>& y, Iterator first, Iterator last)
+// moves the elements of y in [first,last) ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == head_ || !first.Valid() || !last.Valid() || first.curr_ == y.head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (first == last || pos == first || pos == last) return; // nothing to move, or already in place
+  if (this != &y && !(alloc_ == y.alloc_))
+  {
+    std::cerr << "** List error: Splice() called with lists of unequal allocators\n";
+    return;
+  }
+  if (this != &y)
+  {
+    size_t n = 0;
+    for (Link * link = first.curr_; link != last.curr_; link = y.Next(link))
+      ++n;
+    size_ += n;
+    y.size_ -= n;
+  }
+  Transfer(pos.curr_,y,first.curr_,last.curr_);
+  if (this != &y)
+    y.index_.Rebuild(y.First(),y.Last());
+  index_.Rebuild(First(),Last());
+}
+
 //------------------------------------
-//     List<T>::Reverse Implementation
+//     List<T>::Reverse Implementations
 //------------------------------------
 
-template < typename T >
-void List<T>::Reverse ()
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Reverse ()
+// no link is touched: the list changes direction
+{
+  std::swap(head_,tail_);
+  reversed_ = !reversed_;
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::ReverseLinks ()
 {
   // swap prev_ and next_ for each link
-  typename List<T>::Link * link(head_), * temp(nullptr);
+  typename List<T,I,A,R>::Link * link(head_), * temp(nullptr);
   do
   {
     temp        = link->next_;
@@ -79,21 +300,27 @@ void List<T>::Reverse ()
   temp  = head_;
   head_ = tail_;
   tail_ = temp;
+  index_.Rebuild(First(),Last());
 }
 
 //------------------------------------
 //     List<T>::Shuffle Implementation
 //------------------------------------
 
-template < typename T >
-void List<T>::Shuffle ()
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Shuffle ()
 {
-  if (head_->next_ == tail_ || head_->next_->next_ == tail_)
+  if (Next(head_) == tail_ || Next(Next(head_)) == tail_)
     return;
   char  toggle = 0;
 
   // manipulate pointers instead of using API which would call new/delete
-  List<T> aux1,aux2;
+  List<T,I,A,R> aux1,aux2;
+  if (reversed_) // same direction as this list, so no link is flipped moving back
+  {
+    aux1.Reverse();
+    aux2.Reverse();
+  }
   Iterator i = Begin();
   Link * link;
   // put every 2nd, 3rd links into aux lists in reverse order
@@ -108,12 +335,12 @@ void List<T>::Shuffle ()
     else
     {
       link = i.curr_;
-      i.curr_ = i.curr_->next_;      // ++i
+      ++i;
       link = LinkOut(link);          // Remove(i)
       if (toggle == 1)
-        LinkIn(aux1.head_->next_,link); // aux1.PushFront
+        aux1.LinkIn(aux1.Next(aux1.head_),link); // aux1.PushFront
       else
-        LinkIn(aux2.head_->next_,link); // aux2.PushFront        
+        aux2.LinkIn(aux2.Next(aux2.head_),link); // aux2.PushFront
     }
   }
   /* // show the three lists at this stage:
@@ -122,39 +349,56 @@ void List<T>::Shuffle ()
   std::cout << aux2.Size() << " aux2: "; aux2.Display(std::cout, ' '); std::cout << '\n';
   // */
 
-  // 2: splice aux2 to front of list and fix aux structure as empty list
-  Link* afirst = aux2.head_->next_;
-  Link* alast  = aux2.tail_->prev_;
-  head_->next_->prev_ = alast;
-  alast->next_ = head_->next_;
-  afirst->prev_ = head_;
-  head_->next_ = afirst;
-  aux2.tail_->prev_ = aux2.head_;
-  aux2.head_->next_ = aux2.tail_;
-
-  // 3: splice aux1 to front of list and fix aux structure as empty list
-  afirst = aux1.head_->next_;
-  alast  = aux1.tail_->prev_;
-  head_->next_->prev_ = alast;
-  alast->next_ = head_->next_;
-  afirst->prev_ = head_;
-  head_->next_ = afirst;
-  aux1.tail_->prev_ = aux1.head_;
-  aux1.head_->next_ = aux1.tail_;
-  // */
-  
-  /* // 3: splice aux1 to back of list and fix aux structure as empty list
-  afirst = aux1.head_->next_;
-  alast  = aux1.tail_->prev_;
-  tail_->prev_->next_ = afirst;
-  afirst->prev_ = tail_->prev_;
-  alast->next_ = tail_;
-  tail_->prev_ = alast;
-  aux1.tail_->prev_ = aux1.head_;
-  aux1.head_->next_ = aux1.tail_;
-  // */
+  // 2: splice aux2 to front of list; Transfer leaves aux structure as empty list
+  if (aux2.Next(aux2.head_) != aux2.tail_)
+    Transfer(Next(head_),aux2,aux2.Next(aux2.head_),aux2.tail_);
+
+  // 3: splice aux1 to front of list
+  if (aux1.Next(aux1.head_) != aux1.tail_)
+    Transfer(Next(head_),aux1,aux1.Next(aux1.head_),aux1.tail_);
   
   // std::cout << Size()      << " List: "; Display(std::cout, ' '); std::cout << '\n';
+  index_.Rebuild(First(),Last());
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Shuffle (fsu::RandomBase& ran)
+// Fisher-Yates over an array of the active links, then relink them in the new order;
+// the unused links between tail_ and head_ stay where they are
+{
+  if (size_ < 2)
+    return;
+  Link ** link = new(std::nothrow) Link* [size_];
+  if (link == nullptr)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    return;
+  }
+  size_t n = 0;
+  for (Link * curr = Next(head_); curr != tail_; curr = Next(curr))
+    link[n++] = curr;
+  for (size_t i = n - 1; i > 0; --i)
+    std::swap(link[i],link[ran.Below(i + 1)]);
+
+  // relink head_, link[0], ... , link[n-1], tail_ in the direction of the list
+  Link * prev = head_;
+  for (size_t i = 0; i < n; ++i)
+  {
+    Next(prev) = link[i];
+    Prev(link[i]) = prev;
+    prev = link[i];
+  }
+  Next(prev) = tail_;
+  Prev(tail_) = prev;
+  delete [] link;
+  index_.Rebuild(First(),Last());
+}
+
+template < typename T , class I , class A , class R >
+void List<T,I,A,R>::Shuffle (uint64_t seed)
+{
+  fsu::RandomBase ran(seed);
+  Shuffle(ran);
 }
 
 // end macromutators */
@@ -0,0 +1,135 @@
+/*
+    list_link.cpp
+    Andrew J Wood
+
+    The relinking steps shared by fsu::List (list.cpp, list_macro.cpp) and
+    fsu::IntrusiveList (ilist.cpp, ilist_macro.cpp)
+
+    L is the link type, a List<T>::Link or a ListHook; only its members
+    prev_ and next_ are used, through a LinkDirection<L>, which L befriends.
+    The direction says which of the two is "next": fsu::List passes the one
+    matching its reversed_ flag (list.h, note [23]), IntrusiveList always
+    the forward one. Index, size and sorted state stay with the callers.
+*/
+
+//----------------------------------
+//     LinkDirection<L>
+//----------------------------------
+
+template < class L >
+class LinkDirection
+// the neighbours of a link in a list that runs along next_, or along
+// prev_ when reversed
+{
+public:
+  explicit LinkDirection (bool reversed = 0) : reversed_(reversed) {}
+
+  L *& Next     (L * link) const { return reversed_ ? link->prev_ : link->next_; }
+  L *& Prev     (L * link) const { return reversed_ ? link->next_ : link->prev_; }
+  bool Reversed () const         { return reversed_; }
+
+private:
+  bool reversed_;
+} ;
+
+//----------------------------------
+//     Relinking Implementations
+//----------------------------------
+
+template < class L , class D >
+void InsertLink (L * location, L * newLink, const D& d)
+// link newLink into a list at (ahead of) location
+{
+  d.Next(newLink) = location;
+  d.Prev(newLink) = d.Prev(location);
+  d.Prev(location) = newLink;
+  d.Next(d.Prev(newLink)) = newLink;
+}
+
+template < class L >
+L * EraseLink (L * oldLink)
+// unlink oldLink from its list, return oldLink with both pointers null
+{
+  LinkDirection<L> d;
+  d.Next(d.Prev(oldLink)) = d.Next(oldLink);
+  d.Prev(d.Next(oldLink)) = d.Prev(oldLink);
+  d.Prev(oldLink) = nullptr;
+  d.Next(oldLink) = nullptr;
+  return oldLink;
+}
+
+template < class L , class D >
+void TransferLinks (L * location, const D& to, L * first, L * last, const D& from)
+// unlink the non-empty chain [first,last) from a list running in direction
+// from and link it in ahead of location, in a list running in direction to;
+// when the two differ each moved link is flipped, in linear time
+{
+  L * back = from.Prev(last);
+  from.Next(from.Prev(first)) = last;
+  from.Prev(last) = from.Prev(first);
+  if (from.Reversed() != to.Reversed())
+  {
+    for (L * link = first; link != last; )
+    {
+      L * next = from.Next(link);
+      std::swap(from.Next(link),from.Prev(link));
+      link = next;
+    }
+  }
+  to.Prev(first) = to.Prev(location);
+  to.Next(back) = location;
+  to.Next(to.Prev(location)) = first;
+  to.Prev(location) = back;
+}
+
+template < class L , class D , class P , class V >
+void MergeLinks (L * head, L * tail, const D& d, L * yhead, L * ytail, const D& yd, P& comp, V value)
+// moves the links between yhead and ytail into those between head and tail,
+// each ahead of the first x link it is strictly less than; value(link) is
+// the element at link. If both runs are ordered the result is ordered, and
+// yhead is left linked to ytail.
+{
+  L * xcurr = d.Next(head);   // x = the list of head
+  L * ycurr = yd.Next(yhead); // y = the list of yhead
+
+  // merge while both lists are not empty
+  while (xcurr != tail && ycurr != ytail)
+  {
+    if (comp(value(ycurr),value(xcurr))) // y < x
+    {
+      ycurr = yd.Next(ycurr);
+      TransferLinks(xcurr,d,yd.Prev(ycurr),ycurr,yd);
+    }
+    else // x <= y
+    {
+      xcurr = d.Next(xcurr);
+    }
+  }
+
+  // splice in remainder of y
+  if (ycurr != ytail)
+    TransferLinks(tail,d,ycurr,ytail,yd);
+}
+
+template < class L >
+void ReverseChain (L * head, L * tail)
+// reverses the links strictly between head and tail, which stay where they
+// are; head runs to tail along next_
+{
+  LinkDirection<L> d;
+  if (d.Next(head) == tail)
+    return;
+  L * first = d.Next(head), * last = d.Prev(tail);
+
+  // swap prev_ and next_ for each link
+  for (L * link = first; link != tail; )
+  {
+    L * next = d.Next(link);
+    std::swap(d.Next(link),d.Prev(link));
+    link = next; // move to "old next" = link->prev_
+  }
+  d.Next(head)  = last;
+  d.Prev(last)  = head;
+  d.Prev(tail)  = first;
+  d.Next(first) = tail;
+}
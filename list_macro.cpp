@@ -4,98 +4,353 @@
     Chris Lacher
 
     Implementation of List<T>:: macroscopic (whole list) mutators
-    Merge, Reverse, Shuffle
+    Sort, Merge, MergeAll, Reverse, Shuffle, Splice
+
+    These relink many links at once, so they end by rebuilding the index
+    of each list involved [19]
 
     Copyright 2016, R. C. Lacher
 */
 
+//----------------------------------
+//     List<T>::Sort Implementations
+//----------------------------------
+
+template < typename T , class I , class A >
+template < class P >
+void List<T,I,A>::Sort (P& comp)
+// bottom-up merge sort of the links, in list_sort.cpp; a list already in
+// order is left as it is after an O(n) check [25]
+{
+  const bool less = std::is_same < P , fsu::LessThan<T> > ::value;
+  if ((sorted_ || !less) && Ordered(comp))
+  {
+    sorted_ = sorted_ || less;
+    return;
+  }
+  if (reversed_) // sort the links along next_ into the opposite order [23]
+  {
+    auto flip = [&comp] (T& t1, T& t2) { return comp(t2,t1); };
+    SortLinks(tail_,head_,flip);
+  }
+  else
+    SortLinks(head_,tail_,comp);
+  index_.Rebuild(First(),Last());
+  sorted_ = less;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
 //-----------------------------------
 //     List<T>::Merge Implementations
 //-----------------------------------
 
-template < typename T >
+template < typename T , class I , class A >
 template < class P >
-void List<T>::Merge (List<T>& y, P& p)
+void List<T,I,A>::Merge (List<T,I,A>& y, P& p)
 // merges x into this list; post: true = x.Empty()
 // if both lists are ordered result is ordered
 {
   if (this == &y) return;
-  Link * xcurr = head_->next_;   // x = this list
-  Link * ycurr = y.head_->next_; // y = that list
+  Link * first = y.Next(y.head_);
+  if (!Rehome(y,first,y.tail_)) return;
+  bool sorted = sorted_ && y.sorted_ && std::is_same < P , fsu::LessThan<T> > ::value;
+
+  // the merge of list_link.cpp leaves y structurally correct for empty
+  MergeLinks(head_,tail_,Direction(),y.head_,y.tail_,y.Direction(),p,
+             [] (Link * link) -> T& { return link->Tval_; });
+
+  // all of y's elements now belong to this list
+  size_ += y.size_;
+  y.size_ = 0;
+  index_.Rebuild(First(),Last());
+  y.index_.Rebuild(y.First(),y.Last());
+  sorted_ = sorted;
+  y.sorted_ = 1;
+  y.finger_ = nullptr;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Merge (List<T,I,A>& y )
+{
+  fsu::LessThan<T> p;
+  Merge(y,p);
+}
+
+template < typename T , class I , class A >
+template < class P >
+void List<T,I,A>::MergeAll (List<T,I,A>* lists[], size_t k, P& p)
+// k-way merge with a loser tree: src[0] is this list, src[1..m) the distinct
+// lists of lists[]; loser[n] is the source that lost the match at node n,
+// and the source w that won the whole tree gives the next link [26]
+{
+  List ** src   = new(std::nothrow) List* [k + 1];
+  Link ** curr  = new(std::nothrow) Link* [k + 1];     // front link of each source
+  size_t * loser = new(std::nothrow) size_t [2 * (k + 1)]; // losers, then winners while building
+  if (src == nullptr || curr == nullptr || loser == nullptr)
+  {
+    delete [] src;
+    delete [] curr;
+    delete [] loser;
+    for (size_t j = 0; j < k; ++j) // the same order, with more comparisons
+      if (lists[j] != nullptr) Merge(*lists[j],p);
+    return;
+  }
+  bool sorted = sorted_ && std::is_same < P , fsu::LessThan<T> > ::value;
+  size_t m = 0;
+  src[m++] = this;
+  for (size_t j = 0; j < k; ++j)
+  {
+    List * y = lists[j];
+    bool skip = (y == nullptr || y->Empty());
+    for (size_t i = 0; i < m && !skip; ++i)
+      skip = (src[i] == y);
+    if (skip) continue;
+    Link * first = y->Next(y->head_);
+    if (!Rehome(*y,first,y->tail_)) continue;
+    src[m++] = y;
+    sorted = sorted && y->sorted_;
+  }
+  for (size_t i = 0; i < m; ++i)
+    curr[i] = src[i]->Next(src[i]->head_);
 
-  // merge while both lists are not empty
-  while (xcurr != tail_ && ycurr != y.tail_)
+  // a beats b: a is not exhausted and its front comes first; ties go to the lower index
+  auto beats = [&] (size_t a, size_t b) -> bool
   {
-    if (p(ycurr->Tval_,xcurr->Tval_)) // y < x
-    {
-      ycurr = ycurr->next_;
-      LinkIn(xcurr,ycurr->prev_);
-    }
-    else // x <= y
-    {
-      xcurr = xcurr->next_;
-    }
+    if (curr[b] == src[b]->tail_) return 1;
+    if (curr[a] == src[a]->tail_) return 0;
+    return a < b ? !p(curr[b]->Tval_,curr[a]->Tval_) : p(curr[a]->Tval_,curr[b]->Tval_);
+  };
+
+  // build the tree: nodes 1..m-1, leaf m+i for source i
+  size_t * win = loser + m;
+  for (size_t n = m - 1; n > 0; --n)
+  {
+    size_t l = 2 * n < m ? win[2 * n] : 2 * n - m;
+    size_t r = 2 * n + 1 < m ? win[2 * n + 1] : 2 * n + 1 - m;
+    if (beats(l,r)) { win[n] = l; loser[n] = r; }
+    else            { win[n] = r; loser[n] = l; }
   }
+  size_t w = m > 1 ? win[1] : 0;
 
-  // splice in remainder of y
-  if (ycurr != y.tail_)
+  // take the front of the winner, then replay its path to the root
+  Link * prev = head_;
+  while (curr[w] != src[w]->tail_)
   {
-    tail_->prev_->next_ = ycurr;
-    ycurr->prev_ = tail_->prev_;
-    tail_->prev_ = (y.tail_)->prev_;
-    (y.tail_)->prev_->next_ = tail_;
+    Link * link = curr[w];
+    curr[w] = src[w]->Next(link); // read before link is relinked
+    Next(prev) = link;
+    Prev(link) = prev;
+    prev = link;
+    for (size_t n = (w + m) / 2; n > 0; n /= 2)
+      if (beats(loser[n],w))
+        std::swap(loser[n],w);
   }
+  Next(prev) = tail_;
+  Prev(tail_) = prev;
 
-  // make y structurally correct for empty
-  (y.head_)->next_ = y.tail_;
-  (y.tail_)->prev_ = y.head_;
+  // all links now belong to this list
+  for (size_t i = 1; i < m; ++i)
+  {
+    List * y = src[i];
+    y->Next(y->head_) = y->tail_;
+    y->Prev(y->tail_) = y->head_;
+    size_ += y->size_;
+    y->size_ = 0;
+    y->index_.Rebuild(y->First(),y->Last());
+    y->sorted_ = 1;
+    y->finger_ = nullptr;
+  }
+  index_.Rebuild(First(),Last());
+  sorted_ = sorted;
+  delete [] src;
+  delete [] curr;
+  delete [] loser;
 }
 
-template < typename T >
-void List<T>::Merge (List<T>& y )
+template < typename T , class I , class A >
+void List<T,I,A>::MergeAll (List<T,I,A>* lists[], size_t k)
 {
   fsu::LessThan<T> p;
-  Merge(y,p);
+  MergeAll(lists,k,p);
+}
+
+template < typename T , class I , class A >
+bool List<T,I,A>::Rehome (List<T,I,A>& y, Link *& first, Link * last)
+// when y uses another pool or allocator [21], replace each link of y in
+// [first,last) with one from this list's; first is updated to the new first link.
+// All the new links are made before y is touched, so on failure y is unchanged.
+{
+  if (pool_ == y.pool_ && (pool_ != nullptr || alloc_ == y.alloc_))
+    return 1;
+  Link * newLinks = nullptr; // chained through next_, last made first
+  Link * oldLink;
+  for (oldLink = first; oldLink != last; oldLink = y.Next(oldLink))
+  {
+    Link * newLink = NewLink(oldLink->Tval_);
+    if (newLink == nullptr)
+    {
+      while (newLinks != nullptr)
+      {
+        newLink = newLinks;
+        newLinks = newLinks->next_;
+        DeleteLink(newLink);
+      }
+      return 0;
+    }
+    newLink->next_ = newLinks;
+    newLinks = newLink;
+  }
+  // the chain holds the copies in reverse, so swap from the back of the range
+  Link * before = y.Prev(first);
+  oldLink = y.Prev(last);
+  while (newLinks != nullptr)
+  {
+    Link * newLink = newLinks;
+    newLinks = newLinks->next_;
+    Link * prior = y.Prev(oldLink);
+    y.LinkIn(oldLink,newLink);
+    y.DeleteLink(y.LinkOut(oldLink));
+    oldLink = prior;
+  }
+  first = y.Next(before);
+  return 1;
 }
 
 //------------------------------------
-//     List<T>::Reverse Implementation
+//     List<T>::Splice Implementations
 //------------------------------------
 
-template < typename T >
-void List<T>::Reverse ()
+template < typename T , class I , class A >
+void List<T,I,A>::Splice (Iterator pos, List<T,I,A>& y)
+// moves all elements of y ahead of pos; post: y.Empty()
+{
+  if (this == &y || y.Next(y.head_) == y.tail_) return;
+  if (!pos.Valid() || pos.curr_ == head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid position\n";
+    return;
+  }
+  Link * first = y.Next(y.head_);
+  if (!Rehome(y,first,y.tail_)) return;
+  bool sorted = sorted_ && y.sorted_;
+  Transfer(pos.curr_,y,first,y.tail_);
+  sorted_ = sorted && InOrder(Prev(first),first) && InOrder(Prev(pos.curr_),pos.curr_);
+  size_ += y.size_;
+  y.size_ = 0;
+  index_.Rebuild(First(),Last());
+  y.index_.Rebuild(y.First(),y.Last());
+  y.sorted_ = 1;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Splice (Iterator pos, List<T,I,A>& y, Iterator i)
+// moves the element at i in y ahead of pos
 {
-  if (head_->next_ == tail_)
+  if (!pos.Valid() || pos.curr_ == head_ || !i.Valid() || i.curr_ == y.head_ || i.curr_ == y.tail_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
     return;
+  }
+  if (pos.curr_ == i.curr_ || pos.curr_ == y.Next(i.curr_)) return; // already in place
+  Link * first = i.curr_;
+  if (!Rehome(y,first,y.Next(i.curr_))) return;
+  y.index_.LinkingOut(first); // one link: the indexes are updated, not rebuilt
+  bool sorted = sorted_;
+  Link * before = y.Prev(first);
+  Transfer(pos.curr_,y,first,y.Next(first));
+  if (this == &y)
+    sorted = sorted && InOrder(before,Next(before)); // the gap it left
+  sorted_ = sorted && InOrder(Prev(first),first) && InOrder(first,pos.curr_);
+  index_.LinkedIn(first);
+  ++size_;
+  --y.size_;
+}
 
-  // swap prev_ and next_ for each link
-  typename List<T>::Link * link(head_), * temp(nullptr);
-  while (link != nullptr)
+template < typename T , class I , class A >
+void List<T,I,A>::Splice (Iterator pos, List<T,I,A>& y, Iterator first, Iterator last)
+// moves the elements of y in [first,last) ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == head_ || !first.Valid() || !last.Valid() || first.curr_ == y.head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (first == last || pos == first || pos == last) return; // nothing to move, or already in place
+  bool sorted = sorted_ && y.sorted_;
+  Link * begin = first.curr_;
+  if (this != &y)
+  {
+    size_t n = 0;
+    for (Link * link = first.curr_; link != last.curr_; link = y.Next(link))
+      ++n;
+    if (!Rehome(y,begin,last.curr_)) return;
+    Transfer(pos.curr_,y,begin,last.curr_);
+    size_ += n;
+    y.size_ -= n;
+    y.index_.Rebuild(y.First(),y.Last());
+  }
+  else
   {
-    temp        = link->next_;
-    link->next_ = link->prev_;
-    link->prev_ = temp;
-    link        = temp; // move to "old next" = link->prev_
+    Link * before = Prev(begin);
+    Transfer(pos.curr_,*this,begin,last.curr_);
+    sorted = sorted && InOrder(before,Next(before)); // the gap the range left
   }
-  // swap head_ and tail_
-  temp  = head_;
-  head_ = tail_;
-  tail_ = temp;
+  sorted_ = sorted && InOrder(Prev(begin),begin) && InOrder(Prev(pos.curr_),pos.curr_);
+  index_.Rebuild(First(),Last());
+}
+
+//------------------------------------
+//     List<T>::Reverse Implementations
+//------------------------------------
+
+template < typename T , class I , class A >
+void List<T,I,A>::Reverse ()
+// the links stay as they are and the list changes direction [23]
+{
+  if (Next(head_) == tail_)
+    return;
+  std::swap(head_,tail_);
+  reversed_ = !reversed_;
+  sorted_ = (size_ < 2);
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::ReverseLinks ()
+{
+  if (Next(head_) == tail_)
+    return;
+
+  // the links between the one with no prev_ and the one with no next_;
+  // head_ and tail_ stay where they are
+  ReverseChain(First(),Last());
+  index_.Rebuild(First(),Last());
+  sorted_ = (size_ < 2);
 }
 
 //------------------------------------
 //     List<T>::Shuffle Implementation
 //------------------------------------
 
-template < typename T >
-void List<T>::Shuffle ()
+template < typename T , class I , class A >
+void List<T,I,A>::Shuffle ()
 {
-  if (head_->next_ == tail_ || head_->next_->next_ == tail_)
+  if (Next(head_) == tail_ || Next(Next(head_)) == tail_)
     return;
   char  toggle = 0;
 
   // manipulate pointers instead of using API which would call new/delete
-  List<T> aux1,aux2;
+  List<T,I,A> aux1,aux2;
+  if (reversed_) // same direction as this list, so no link is flipped moving back [23]
+  {
+    aux1.Reverse();
+    aux2.Reverse();
+  }
   Iterator i = Begin();
   Link * link;
   // put every 2nd, 3rd links into aux lists in reverse order
@@ -110,12 +365,12 @@ void List<T>::Shuffle ()
     else
     {
       link = i.curr_;
-      i.curr_ = i.curr_->next_;      // ++i
+      ++i;
       link = LinkOut(link);          // Remove(i)
       if (toggle == 1)
-        LinkIn(aux1.head_->next_,link); // aux1.PushFront
+        aux1.LinkIn(aux1.Next(aux1.head_),link); // aux1.PushFront
       else
-        LinkIn(aux2.head_->next_,link); // aux2.PushFront        
+        aux2.LinkIn(aux2.Next(aux2.head_),link); // aux2.PushFront
     }
   }
   /* // show the three lists at this stage:
@@ -124,39 +379,57 @@ void List<T>::Shuffle ()
   std::cout << aux2.Size() << " aux2: "; aux2.Display(std::cout, ' '); std::cout << '\n';
   // */
 
-  // 2: splice aux2 to front of list and fix aux structure as empty list
-  Link* afirst = aux2.head_->next_;
-  Link* alast  = aux2.tail_->prev_;
-  head_->next_->prev_ = alast;
-  alast->next_ = head_->next_;
-  afirst->prev_ = head_;
-  head_->next_ = afirst;
-  aux2.tail_->prev_ = aux2.head_;
-  aux2.head_->next_ = aux2.tail_;
-
-  // 3: splice aux1 to front of list and fix aux structure as empty list
-  afirst = aux1.head_->next_;
-  alast  = aux1.tail_->prev_;
-  head_->next_->prev_ = alast;
-  alast->next_ = head_->next_;
-  afirst->prev_ = head_;
-  head_->next_ = afirst;
-  aux1.tail_->prev_ = aux1.head_;
-  aux1.head_->next_ = aux1.tail_;
-  // */
-  
-  /* // 3: splice aux1 to back of list and fix aux structure as empty list
-  afirst = aux1.head_->next_;
-  alast  = aux1.tail_->prev_;
-  tail_->prev_->next_ = afirst;
-  afirst->prev_ = tail_->prev_;
-  alast->next_ = tail_;
-  tail_->prev_ = alast;
-  aux1.tail_->prev_ = aux1.head_;
-  aux1.head_->next_ = aux1.tail_;
-  // */
+  // 2: splice aux2 to front of list; Transfer leaves aux structure as empty list
+  if (aux2.Next(aux2.head_) != aux2.tail_)
+    Transfer(Next(head_),aux2,aux2.Next(aux2.head_),aux2.tail_);
+
+  // 3: splice aux1 to front of list
+  if (aux1.Next(aux1.head_) != aux1.tail_)
+    Transfer(Next(head_),aux1,aux1.Next(aux1.head_),aux1.tail_);
   
   // std::cout << Size()      << " List: "; Display(std::cout, ' '); std::cout << '\n';
+  index_.Rebuild(First(),Last());
+  sorted_ = 0;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Shuffle (fsu::RandomBase& ran)
+// Fisher-Yates over an array of the links, then relink in the new order [24]
+{
+  if (size_ < 2)
+    return;
+  Link ** link = new(std::nothrow) Link* [size_];
+  if (link == nullptr)
+  {
+    std::cerr << "** List error: memory allocation failure\n";
+    return;
+  }
+  size_t n = 0;
+  for (Link * curr = Next(head_); curr != tail_; curr = Next(curr))
+    link[n++] = curr;
+  for (size_t i = n - 1; i > 0; --i)
+    std::swap(link[i],link[ran.Below(i + 1)]);
+
+  // relink head_, link[0], ... , link[n-1], tail_ in the direction of the list
+  Link * prev = head_;
+  for (size_t i = 0; i < n; ++i)
+  {
+    Next(prev) = link[i];
+    Prev(link[i]) = prev;
+    prev = link[i];
+  }
+  Next(prev) = tail_;
+  Prev(tail_) = prev;
+  delete [] link;
+  index_.Rebuild(First(),Last());
+  sorted_ = 0;
+}
+
+template < typename T , class I , class A >
+void List<T,I,A>::Shuffle (uint64_t seed)
+{
+  fsu::RandomBase ran(seed);
+  Shuffle(ran);
 }
 
 // end macromutators */
@@ -0,0 +1,125 @@
+/*
+    list_psort.cpp
+    Andrew J Wood
+
+    slave file to list.h
+
+    Implementation of List<T>::Sort(p,threads), a parallel version of the
+    bottom-up merge sort in list_sort.cpp [18]
+
+    The list is cut into runs held by temporary lists that share this
+    list's pool, so the runs are sorted by Sort(p) and combined by
+    Merge(list,p) with the links relinked in place.
+*/
+
+//-------------------------------------------
+//     List<T>::Sort (parallel) Implementation
+//-------------------------------------------
+
+template < typename T , class I , class A >
+template < class P >
+void List<T,I,A>::Sort (P& comp, size_t threads)
+// run[0] is this list; run[j] holds the j-th slice of it. Runs are sorted,
+// then run[j] absorbs run[j+step] for step = 1, 2, 4, ... so each merge
+// takes its left operand from earlier positions, as stability requires
+{
+  if (threads == 0)
+    threads = std::thread::hardware_concurrency();
+  if (threads > size_ / LIST_SORT_MIN_RUN)
+    threads = size_ / LIST_SORT_MIN_RUN;
+  if (threads < 2)
+  {
+    Sort(comp);
+    return;
+  }
+  if ((sorted_ || !std::is_same < P , fsu::LessThan<T> > ::value) && Ordered(comp))
+    return; // already in order [25]
+
+  List ** run = new(std::nothrow) List* [threads];
+  std::thread * worker = new(std::nothrow) std::thread [threads];
+  if (run == nullptr || worker == nullptr)
+  {
+    delete [] run;
+    delete [] worker;
+    Sort(comp);
+    return;
+  }
+
+  // cut [Begin(),End()) into threads runs, the first size_ % threads one longer
+  size_t length = size_ / threads, extra = size_ % threads;
+  run[0] = this;
+  Link * first = Next(head_);
+  for (size_t j = 0; j < threads; ++j)
+  {
+    size_t n = length + (j < extra ? 1 : 0);
+    Link * last = first;
+    for (size_t k = 0; k < n; ++k)
+      last = Next(last);
+    if (j > 0)
+    {
+      run[j] = new(std::nothrow) List(pool_,alloc_);
+      if (run[j] == nullptr)
+      {
+        // put the runs cut so far back ahead of the uncut rest, in order, and sort here
+        for (size_t k = 1; k < j; ++k)
+        {
+          Transfer(first,*run[k],run[k]->Next(run[k]->head_),run[k]->tail_);
+          run[k]->size_ = 0;
+          delete run[k];
+        }
+        delete [] run;
+        delete [] worker;
+        Sort(comp);
+        return;
+      }
+      if (reversed_)
+        run[j]->Reverse(); // runs share the direction of this list [23]
+      run[j]->Transfer(run[j]->tail_,*this,first,last);
+      run[j]->size_ = n;
+    }
+    first = last;
+  }
+  size_ = length + (0 < extra ? 1 : 0);
+
+  // sort each run on its own thread; a run whose thread cannot start is sorted here
+  auto sort = [&comp] (List * x) { x->Sort(comp); };
+  for (size_t j = 1; j < threads; ++j)
+  {
+    try
+    {
+      worker[j] = std::thread(sort,run[j]);
+    }
+    catch (const std::system_error&)
+    {
+      sort(run[j]);
+    }
+  }
+  sort(run[0]);
+  for (size_t j = 1; j < threads; ++j)
+    if (worker[j].joinable()) worker[j].join();
+
+  // merge neighbouring runs in rounds; the merges of one round are independent
+  auto merge = [&comp] (List * x, List * y) { x->Merge(*y,comp); };
+  for (size_t step = 1; step < threads; step *= 2)
+  {
+    for (size_t j = 2 * step; j + step < threads; j += 2 * step)
+    {
+      try
+      {
+        worker[j] = std::thread(merge,run[j],run[j + step]);
+      }
+      catch (const std::system_error&)
+      {
+        merge(run[j],run[j + step]);
+      }
+    }
+    merge(run[0],run[step]);
+    for (size_t j = 2 * step; j + step < threads; j += 2 * step)
+      if (worker[j].joinable()) worker[j].join();
+  }
+
+  for (size_t j = 1; j < threads; ++j)
+    delete run[j];
+  delete [] run;
+  delete [] worker;
+}
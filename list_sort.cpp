@@ -1,38 +1,98 @@
 /*
-    list_insertion_sort.cpp
+    list_sort.cpp
     10/19/2013
     Chris Lacher
 
     Implementation of List<T>::Sort() using the
-    insertion sort algorithm
+    bottom-up merge sort algorithm
+
+    The links are relinked in place, so T values are never copied and
+    iterators stay attached to their elements. Only the Link members
+    prev_, next_ and Tval_ are used, so this slave file serves both
+    fsu::List and alt2c::List: each defines Sort(p) as a call to
+    SortLinks(head_,tail_,p), and its Link befriends SortLinks.
+    fsu::IntrusiveList has no Tval_; it calls the version taking a
+    function that finds the element of a link.
 
     Copyright 2013, R. C. Lacher
 */
 
 //----------------------------------
-//     List<T>::Sort Implementations
+//     SortLinks Implementation
 //----------------------------------
 
-template < typename T >
-template < class P >
-void List<T>::Sort (P& comp)
-// insertion sort: in place, stable, Theta(n*n)
+template < class L , class P , class V >
+void SortLinks (L * head, L * tail, P& comp, V value)
+// bottom-up merge sort of the links strictly between head and tail:
+// in place, stable, Theta(n log n); value(link) is the element at link
 {
-  Iterator i, j, k;
-  T t;
-  for (i = Begin(); i != End(); ++i)
+  if (head->next_ == tail || head->next_->next_ == tail)
+    return;
+
+  // detach the elements as a chain of next_ pointers terminated by nullptr
+  L * list = head->next_;
+  tail->prev_->next_ = nullptr;
+
+  L * p, * q, * e, * last;
+  size_t runSize = 1, numMerges, psize, qsize;
+  do
   {
-    t = *i;
-    for (k = i, j = k--; j != Begin() && comp(t,*k); --j, --k)
-      *j = *k;
-    *j = t;
+    p = list;
+    list = nullptr;
+    last = nullptr;
+    numMerges = 0;
+    // merge adjacent pairs of runs of length runSize
+    while (p != nullptr)
+    {
+      ++numMerges;
+      q = p;
+      for (psize = 0; psize < runSize && q != nullptr; ++psize)
+        q = q->next_;
+      qsize = runSize;
+
+      while (psize > 0 || (qsize > 0 && q != nullptr))
+      {
+        if (psize == 0)                      // p run exhausted
+        {
+          e = q; q = q->next_; --qsize;
+        }
+        else if (qsize == 0 || q == nullptr) // q run exhausted
+        {
+          e = p; p = p->next_; --psize;
+        }
+        else if (comp(value(q),value(p)))    // q < p
+        {
+          e = q; q = q->next_; --qsize;
+        }
+        else                                 // p <= q: take p first for stability
+        {
+          e = p; p = p->next_; --psize;
+        }
+        if (last == nullptr)
+          list = e;
+        else
+          last->next_ = e;
+        last = e;
+      }
+      p = q;
+    }
+    last->next_ = nullptr;
+    runSize *= 2;
   }
+  while (numMerges > 1);
+
+  // restore prev_ pointers and splice the sorted chain between head and tail
+  head->next_ = list;
+  list->prev_ = head;
+  for (p = list; p->next_ != nullptr; p = p->next_)
+    p->next_->prev_ = p;
+  p->next_ = tail;
+  tail->prev_ = p;
 }
 
-template < typename T >
-void List<T>::Sort ()
+template < class L , class P >
+void SortLinks (L * head, L * tail, P& comp)
+// the element at a link is its Tval_
 {
-  fsu::LessThan<T> p;
-  Sort(p);
+  SortLinks(head,tail,comp,[] (L * link) -> decltype(link->Tval_)& { return link->Tval_; });
 }
-
@@ -0,0 +1,114 @@
+/*
+    liststats.h
+    Andrew J Wood
+
+    Definition of fsu::ListStats and the trait fsu::PayloadBytes<T>
+
+    Stats() on fsu::List, alt2c::List and fsu::UnrolledList returns a
+    ListStats describing the memory the list holds:
+
+      elements      number of elements on the list
+      links         links (or nodes) holding elements
+      spares        allocated links holding no element (alt2c ring)
+      sentinels     head and tail links
+      linkBytes     bytes of all links: (links + spares + sentinels) x link size;
+                    for the alt2c ring, the blocks its links came from [2]
+      objectBytes   the list object itself
+      indexBytes    heap held by the index policy beyond its per-link Hooks
+      payloadBytes  heap owned by the elements, through PayloadBytes<T>
+      retainedBytes the part of payloadBytes held by spares and sentinels (alt2c ring)
+      sparesKeepValues  true iff spares keep the values they last held (alt2c ring)
+
+    MemoryUsage() is Stats().Bytes(), the sum of the byte fields. Link and
+    node sizes are sizeof values; allocator overhead per block is not
+    known to the list and is not counted [1].
+
+    PayloadBytes<T>::Bytes(t) is the heap owned by t beyond sizeof(T). The
+    default is 0 (deep == false), and the list then skips the walk over its
+    elements. A specialization is provided for fsu::String; clients may add
+    their own for other types.
+*/
+
+#ifndef _LISTSTATS_H
+#define _LISTSTATS_H
+
+#include <iostream>    // std::ostream
+#include <cstdlib>     // size_t
+
+namespace fsu
+{
+
+  class String; // xstring.h
+
+  //----------------------------------
+  //     PayloadBytes<T>
+  //----------------------------------
+
+  template < typename T >
+  struct PayloadBytes
+  {
+    static const bool deep = false;  // true iff Bytes may be non-zero
+    static size_t Bytes (const T& ) { return 0; }
+  } ;
+
+  template < >
+  struct PayloadBytes < String >
+  {
+    static const bool deep = true;
+    template < class S > // S = String, deferred so that xstring.h is needed only when used
+    static size_t Bytes (const S& s) { return s.Size() ? s.Size() + 1 : 0; } // buffer + '\0'
+  } ;
+
+  //----------------------------------
+  //     ListStats
+  //----------------------------------
+
+  struct ListStats
+  {
+    size_t elements, links, spares, sentinels;
+    size_t linkBytes, objectBytes, indexBytes, payloadBytes;
+    size_t retainedBytes;     // included in payloadBytes
+    bool   sparesKeepValues;
+
+    ListStats () : elements(0), links(0), spares(0), sentinels(0),
+                   linkBytes(0), objectBytes(0), indexBytes(0), payloadBytes(0),
+                   retainedBytes(0), sparesKeepValues(0) {}
+
+    size_t Bytes () const { return linkBytes + objectBytes + indexBytes + payloadBytes; }
+    double BytesPerElement () const { return elements ? double(Bytes()) / elements : 0.0; }
+  } ;
+
+  inline std::ostream& operator << (std::ostream& os, const ListStats& s)
+  {
+    os << "elements = " << s.elements
+       << " links = " << s.links
+       << " spares = " << s.spares
+       << " sentinels = " << s.sentinels
+       << " bytes = " << s.Bytes()
+       << " (links " << s.linkBytes
+       << " object " << s.objectBytes
+       << " index " << s.indexBytes
+       << " payload " << s.payloadBytes
+       << ") per element = " << s.BytesPerElement();
+    if (s.spares > 0 || s.retainedBytes > 0)
+      os << " spare values " << (s.sparesKeepValues ? "kept" : "reset")
+         << " retained = " << s.retainedBytes;
+    return os;
+  }
+
+} // namespace fsu
+
+/* Notes
+   =====
+
+[1] Links taken from a LinkPool are counted when in use by the list; the
+    pool's idle slots are not, since one pool may be shared by several
+    lists. Pool.Capacity() and Pool.Blocks() describe the pool itself.
+
+[2] alt2c::List allocates links in blocks and a block goes back to the
+    allocator only with its last link, so its linkBytes charges each link
+    its share of its block, the header and freed slots included
+    (list2c.h [4]).
+*/
+
+#endif
@@ -48,6 +48,8 @@
 
 #include <iostream>
 #include <list.h>
+#include <ulist.h>
+#include <plist.h>
 
 // choose one from group A 
 
@@ -91,6 +93,15 @@ const      unsigned int assignPercent  =        1;    // and
 const      unsigned int appendPercent  =        1;    // volatility
 // end A2 */
 
+// choose the container: one typedef switches the whole test
+// (UnrolledList iterators do not survive Insert or Sort, so the test
+// takes i0..i2 from the return of Insert and resets them after Sort)
+typedef fsu::List < ElementType >          ContainerType;
+// typedef fsu::UnrolledList < ElementType >  ContainerType;
+// typedef fsu::List < ElementType , fsu::SkipIndex > ContainerType;
+// typedef fsu::IndexedList < ElementType >   ContainerType; // O(1) Includes, Remove(Tval) in purge
+// typedef fsu::PoolList < ElementType >      ContainerType;
+
 // constants for number of containers and operations
 const unsigned int numObj = 3;  // containers x0, x1, x2
 const unsigned int numOps = 26; // operations 0..25
@@ -107,12 +118,13 @@ int main(int argc, char* argv[])
   std::cout << "\nStarting dynamic random test of List < " << vT << " >"
             << "\n\n" << std::flush;
 
-  // objects
-  fsu::List<ElementType> x0, x1, x2;
-  fsu::List<ElementType>::Iterator i0, i1, i2, iter;
+  // objects - the three lists share one link pool, so Merge moves links directly
+  ContainerType::Pool pool;
+  ContainerType x0(pool), x1(pool), x2(pool);
+  ContainerType::Iterator i0, i1, i2, iter;
   Random_class   ranobj;
   ElementType  Tval;
-  fsu::List<ElementType> * Lptr;
+  ContainerType * Lptr;
 
   // controls
   fsu::Random_int ranint;
@@ -154,7 +166,7 @@ int main(int argc, char* argv[])
             {
               Tval = ranobj();
               if (i0.Valid() && i0 != x0.rEnd())
-                x0.Insert(i0,Tval);
+                i0 = x0.Insert(i0,Tval);
             }
             break;
 
@@ -326,10 +338,12 @@ int main(int argc, char* argv[])
 
           case 23:
             x0.Reverse();
+            i0 = x0.Begin();
             break;
 
           case 24:
             x0.Sort();
+            i0 = x0.Begin();
             break;
 
           case 25:
@@ -370,7 +384,7 @@ int main(int argc, char* argv[])
             {
               Tval = ranobj();
               if (i1.Valid() && i1 != x1.rEnd())
-                x1.Insert(i1,Tval);
+                i1 = x1.Insert(i1,Tval);
             }
             break;
 
@@ -542,10 +556,12 @@ int main(int argc, char* argv[])
 
           case 23:
             x1.Reverse();
+            i1 = x1.Begin();
             break;
 
           case 24:
             x1.Sort();
+            i1 = x1.Begin();
             break;
 
           case 25:
@@ -586,7 +602,7 @@ int main(int argc, char* argv[])
             {
               Tval = ranobj();
               if (i2.Valid() && i2 != x2.rEnd())
-                x2.Insert(i2,Tval);
+                i2 = x2.Insert(i2,Tval);
             }
             break;
 
@@ -758,10 +774,12 @@ int main(int argc, char* argv[])
 
           case 23:
             x2.Reverse();
+            i2 = x2.Begin();
             break;
 
           case 24:
             x2.Sort();
+            i2 = x2.Begin();
             break;
 
           case 25:
@@ -787,6 +805,11 @@ int main(int argc, char* argv[])
                    << "  x0.Size() ==  " << x0.Size() << '\n'
                    << "  x1.Size() ==  " << x1.Size() << '\n'
                    << "  x2.Size() ==  " << x2.Size() << '\n'
+                   << "  x0.Stats() ==  " << x0.Stats() << '\n'
+                   << "  x1.Stats() ==  " << x1.Stats() << '\n'
+                   << "  x2.Stats() ==  " << x2.Stats() << '\n'
+                   << "  pool.InUse() ==  " << pool.InUse() << '\n'
+                   << "  pool.Blocks() == " << pool.Blocks() << '\n'
                    << std::endl;
       }
       if (maxrpts > 0 && numrpts == maxrpts)
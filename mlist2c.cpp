@@ -44,6 +44,7 @@
 #include <iostream>
 #include <iomanip>
 #include <list2c.h>
+#include <aring.h>
 
 // choose one from group A 
 
@@ -87,6 +88,17 @@ const      unsigned int assignPercent  =        1;    // and
 const      unsigned int appendPercent  =        1;    // volatility
 // end A2 */
 
+// choose the retention policy for the unused links of the ring (retention.h);
+// the reports show the links each list has allocated and trimmed
+typedef alt2c::KeepAll              RetentionType;
+// typedef alt2c::FractionRetention RetentionType;
+// typedef alt2c::DecayRetention    RetentionType;
+typedef alt2c::List < ElementType , fsu::NoIndex , std::allocator < ElementType > , RetentionType > ContainerType;
+// hash-indexed, for O(1) Includes and Remove(Tval) in purge (linkindex.h):
+// typedef alt2c::List < ElementType , fsu::HashIndex < std::hash < ElementType > > , std::allocator < ElementType > , RetentionType > ContainerType;
+// the same list on one array, counting slots instead of links (aring.h):
+// typedef alt2c::ArrayRing < ElementType , RetentionType > ContainerType;
+
 // constants for number of containers and operations
 const unsigned int numObj = 3;  // containers x0, x1, x2
 const unsigned int numOps = 26; // operations 0..25
@@ -104,9 +116,9 @@ int main(int argc, char* argv[])
             << "\n\n" << std::flush;
 
   // objects
-  alt2c::List<ElementType> x0, x1, x2;
-  alt2c::List<ElementType>::Iterator i0, i1, i2, iter;
-  alt2c::List<ElementType> * Lptr;
+  ContainerType x0, x1, x2;
+  ContainerType::Iterator i0, i1, i2, iter;
+  ContainerType * Lptr;
   Random_class   ranobj;
   ElementType    Tval;
 
@@ -216,28 +228,28 @@ int main(int argc, char* argv[])
             break;
 
           case 11:   // ++
-            if (i0.Valid())
+            if (i0.Valid() && i0 != x0.End())
               iter = ++i0;
             else
               i0 = x0.Begin();
             break;
 
           case 12:   // --
-            if (i0.Valid())
+            if (i0.Valid() && i0 != x0.rEnd())
               iter = --i0;
             else
               i0 = x0.rBegin();
             break;
         
           case 13:   // ++
-            if (i0.Valid())
+            if (i0.Valid() && i0 != x0.End())
              iter = i0++;
             else
              i0 = x0.Begin();
             break;
         
           case 14:   // --
-            if (i0.Valid())
+            if (i0.Valid() && i0 != x0.rEnd())
              iter = i0--;
             else
              i0 = x0.rBegin();
@@ -334,6 +346,7 @@ int main(int argc, char* argv[])
 
           case 25:
             x0.Reverse();
+            i0 = x0.Begin();
             break;
 
           default: std::cout << " ** bad operation number in case 0\n";
@@ -434,28 +447,28 @@ int main(int argc, char* argv[])
             break;
 
           case 11:   // ++
-            if (i1.Valid())
+            if (i1.Valid() && i1 != x1.End())
               iter = ++i1;
             else
               i1 = x1.Begin();
             break;
 
           case 12:   // --
-            if (i1.Valid())
+            if (i1.Valid() && i1 != x1.rEnd())
               iter = --i1;
             else
               i1 = x1.rBegin();
             break;
         
           case 13:   // ++
-            if (i1.Valid())
+            if (i1.Valid() && i1 != x1.End())
              iter = i1++;
             else
              i1 = x1.Begin();
             break;
         
           case 14:   // --
-            if (i1.Valid())
+            if (i1.Valid() && i1 != x1.rEnd())
              iter = i1--;
             else
              i1 = x1.rBegin();
@@ -552,6 +565,7 @@ int main(int argc, char* argv[])
 
           case 25:
             x1.Reverse();
+            i1 = x1.Begin();
             break;
 
           default: std::cout << " ** bad operation number in case 1\n";
@@ -652,28 +666,28 @@ int main(int argc, char* argv[])
             break;
 
           case 11:   // ++
-            if (i2.Valid())
+            if (i2.Valid() && i2 != x2.End())
               iter = ++i2;
             else
               i2 = x2.Begin();
             break;
 
           case 12:   // --
-            if (i2.Valid())
+            if (i2.Valid() && i2 != x2.rEnd())
               iter = --i2;
             else
               i2 = x2.rBegin();
             break;
         
           case 13:   // ++
-            if (i2.Valid())
+            if (i2.Valid() && i2 != x2.End())
              iter = i2++;
             else
              i2 = x2.Begin();
             break;
         
           case 14:   // --
-            if (i2.Valid())
+            if (i2.Valid() && i2 != x2.rEnd())
              iter = i2--;
             else
              i2 = x2.rBegin();
@@ -770,6 +784,7 @@ int main(int argc, char* argv[])
 
           case 25:
             x2.Reverse();
+            i2 = x2.Begin();
             break;
 
           default: std::cout << " ** bad operation number in case 2\n";
@@ -791,11 +806,11 @@ int main(int argc, char* argv[])
          std::cout << "\nTesting List < " << vT << " >"
                    << " type A" << a
                    << " at trial " << numrpts << " x " << reportInterval << ":\n"
-                   << std::setw(10) << "List" << std::setw(15) << "Size()"  << std::setw(15) << "Excess()"  << '\n' 
-                   << std::setw(10) << "----" << std::setw(15) << "------"  << std::setw(15) << "--------"  << '\n' 
-                   << std::setw(10) << "x0"   << std::setw(15) << x0.Size() << std::setw(15) << x0.Excess() << '\n' 
-                   << std::setw(10) << "x1"   << std::setw(15) << x1.Size() << std::setw(15) << x1.Excess() << '\n' 
-                   << std::setw(10) << "x2"   << std::setw(15) << x2.Size() << std::setw(15) << x2.Excess() << '\n' 
+                   << std::setw(10) << "List" << std::setw(15) << "Size()" << std::setw(15) << "Excess()" << std::setw(15) << "MemoryUsage()" << std::setw(15) << "Allocations" << std::setw(15) << "Blocks" << std::setw(15) << "Trimmed" << '\n' 
+                   << std::setw(10) << "----" << std::setw(15) << "------" << std::setw(15) << "--------" << std::setw(15) << "-------------" << std::setw(15) << "-----------" << std::setw(15) << "------" << std::setw(15) << "-------" << '\n' 
+                   << std::setw(10) << "x0"   << std::setw(15) << x0.Size() << std::setw(15) << x0.Excess() << std::setw(15) << x0.MemoryUsage() << std::setw(15) << x0.Retention().Allocations() << std::setw(15) << x0.Retention().Blocks() << std::setw(15) << x0.Retention().Trimmed() << '\n' 
+                   << std::setw(10) << "x1"   << std::setw(15) << x1.Size() << std::setw(15) << x1.Excess() << std::setw(15) << x1.MemoryUsage() << std::setw(15) << x1.Retention().Allocations() << std::setw(15) << x1.Retention().Blocks() << std::setw(15) << x1.Retention().Trimmed() << '\n' 
+                   << std::setw(10) << "x2"   << std::setw(15) << x2.Size() << std::setw(15) << x2.Excess() << std::setw(15) << x2.MemoryUsage() << std::setw(15) << x2.Retention().Allocations() << std::setw(15) << x2.Retention().Blocks() << std::setw(15) << x2.Retention().Trimmed() << '\n' 
                    << std::flush;
       }
       if (maxrpts > 0 && numrpts == maxrpts)
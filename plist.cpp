@@ -0,0 +1,946 @@
+/*
+    plist.cpp
+    Andrew J Wood
+
+    slave file to plist.h
+
+    Implementation of the PoolList<T> API, except for the macro-mutators
+    (mutators of entire list), which are in plist_macro.cpp
+
+    Nodes are named by index and reached through the pool on every access,
+    never held by reference across an allocation, since an allocation may
+    move the array.
+*/
+
+//----------------------------------
+//     PoolList<T>::Pool Implementations
+//----------------------------------
+
+template < typename T >
+const typename PoolList<T>::Index PoolList<T>::nil;
+
+template < typename T >
+const typename PoolList<T>::Index PoolList<T>::Pool::freeMark;
+
+template < typename T >
+const typename PoolList<T>::Index PoolList<T>::Pool::maxNodes;
+
+template < typename T >
+PoolList<T>::Pool::Pool (size_t capacity)
+  : nodes_(nullptr), capacity_(0), used_(0), free_(nil), inUse_(0)
+{
+  if (capacity > maxNodes)
+    capacity = maxNodes;
+  if (capacity > 0)
+  {
+    nodes_ = static_cast < Node* > (::operator new (capacity * sizeof(Node), std::nothrow));
+    if (nodes_ != nullptr)
+      capacity_ = Index(capacity);
+  }
+}
+
+template < typename T >
+PoolList<T>::Pool::~Pool ()
+// the lists have returned their nodes; destroy any that are left
+{
+  for (Index i = 0; i < used_; ++i)
+  {
+    if (nodes_[i].prev_ != freeMark)
+      nodes_[i].Tval()->~T();
+  }
+  ::operator delete (nodes_);
+}
+
+template < typename T >
+template < class... Args >
+typename PoolList<T>::Index PoolList<T>::Pool::Allocate (Args&&... args)
+// a recycled node, then a never-used node, then the first node of a larger array
+{
+  Index i;
+  if (free_ != nil)
+  {
+    i = free_;
+    free_ = nodes_[i].next_;
+    new (nodes_[i].Tval()) T(std::forward<Args>(args)...);
+  }
+  else if (used_ < capacity_)
+  {
+    i = used_++;
+    new (nodes_[i].Tval()) T(std::forward<Args>(args)...);
+  }
+  else
+  {
+    if (capacity_ == maxNodes)
+      return nil;
+    size_t capacity = capacity_ < 8 ? 16 : 2 * size_t(capacity_);
+    if (capacity > maxNodes)
+      capacity = maxNodes;
+    Node * nodes = static_cast < Node* > (::operator new (capacity * sizeof(Node), std::nothrow));
+    if (nodes == nullptr)
+      return nil;
+    // build the new element first, since args may refer to an element of the old array
+    i = used_++;
+    new (nodes[i].Tval()) T(std::forward<Args>(args)...);
+    for (Index k = 0; k < i; ++k)
+    {
+      nodes[k].prev_ = nodes_[k].prev_;
+      nodes[k].next_ = nodes_[k].next_;
+      if (nodes_[k].prev_ != freeMark)
+      {
+        new (nodes[k].Tval()) T(std::move(*nodes_[k].Tval()));
+        nodes_[k].Tval()->~T();
+      }
+    }
+    ::operator delete (nodes_);
+    nodes_ = nodes;
+    capacity_ = Index(capacity);
+  }
+  nodes_[i].prev_ = nil;
+  nodes_[i].next_ = nil;
+  ++inUse_;
+  return i;
+}
+
+template < typename T >
+void PoolList<T>::Pool::Deallocate (Index i)
+{
+  nodes_[i].Tval()->~T();
+  nodes_[i].prev_ = freeMark;
+  nodes_[i].next_ = free_;
+  free_ = i;
+  --inUse_;
+}
+
+template < typename T >
+size_t PoolList<T>::Pool::Blocks () const
+{
+  return nodes_ == nullptr ? 0 : 1;
+}
+
+template < typename T >
+size_t PoolList<T>::Pool::InUse () const
+{
+  return inUse_;
+}
+
+template < typename T >
+size_t PoolList<T>::Pool::Capacity () const
+{
+  return capacity_;
+}
+
+//----------------------------------
+//     PoolList<T>:: Implementations
+//----------------------------------
+
+// stand-alone functions
+
+template < typename T >
+bool operator == (const PoolList<T>& x1, const PoolList<T>& x2)
+{
+  if (x1.Size() != x2.Size())
+    return 0;
+  typename PoolList<T>::ConstIterator i1, i2;
+  for (
+        i1 = x1.Begin(), i2 = x2.Begin();
+        (i1 != x1.End()) && (i2 != x2.End());
+        ++i1, ++i2
+      )
+  {
+    if (*(i1) != *(i2))
+      return 0;
+  }
+  if (i1 != x1.End() || i2 != x2.End())
+    return 0;
+  return 1;
+}
+
+template < typename T >
+bool operator != (const PoolList<T>& x1, const PoolList<T>& x2)
+{
+  return !(x1 == x2);
+}
+
+template < typename T >
+std::ostream& operator << (std::ostream& os, const PoolList<T>& x2)
+{
+  x2.Display(os);
+  return os;
+}
+
+// end stand-alone functions */
+
+// memory allocator and other private methods
+
+template < typename T >
+template < class... Args >
+typename PoolList<T>::Index PoolList<T>::NewNode (Args&&... args)
+{
+  Index newNode = pool_->Allocate(std::forward<Args>(args)...);
+  if (nil == newNode)
+  {
+    // exception handler
+    std::cerr << "** List error: memory allocation failure\n";
+    return nil;
+  }
+  return newNode;
+}
+
+template < typename T >
+void PoolList<T>::DeleteNode (Index oldNode)
+{
+  pool_->Deallocate(oldNode);
+}
+
+template < typename T >
+void PoolList<T>::LinkIn (Index location, Index newNode)
+// link newNode into list at (ahead of) location
+{
+  Next(newNode) = location;
+  Prev(newNode) = Prev(location);
+  Next(Prev(location)) = newNode;
+  Prev(location) = newNode;
+}
+
+template < typename T >
+typename PoolList<T>::Index PoolList<T>::LinkOut (Index oldNode)
+// unlink oldNode from list, return oldNode
+{
+  Next(Prev(oldNode)) = Next(oldNode);
+  Prev(Next(oldNode)) = Prev(oldNode);
+  Prev(oldNode) = nil;
+  Next(oldNode) = nil;
+  return oldNode;
+}
+
+template < typename T >
+void PoolList<T>::Transfer (Index location, Index first, Index last)
+// unlink the non-empty chain [first,last) and link it into a list at (ahead of) location;
+// both lists use this pool
+{
+  Index back = Prev(last);
+  Next(Prev(first)) = last;
+  Prev(last) = Prev(first);
+  Prev(first) = Prev(location);
+  Next(back) = location;
+  Next(Prev(location)) = first;
+  Prev(location) = back;
+}
+
+template < typename T >
+void PoolList<T>::Init()
+// used by constructors
+{
+  head_ = NewNode();
+  tail_ = NewNode();
+  Next(head_) = tail_;
+  Prev(tail_) = head_;
+  size_ = 0;
+}
+
+template < typename T >
+void PoolList<T>::Append(const PoolList<T>& list)
+// Appends deep copy of rhs - do not apply to self!
+{
+  for (Index i = list.Next(list.head_); i != list.tail_; i = list.Next(i))
+    PushBack(list.Tval(i));
+}
+
+// end private methods */
+
+// constructors and assignment
+
+template < typename T >
+PoolList<T>::PoolList ()  :  pool_(new Pool), own_(1), head_(nil), tail_(nil), size_(0)
+// default constructor
+{
+  Init();
+}
+
+template < typename T >
+PoolList<T>::PoolList (Pool& pool)  :  pool_(&pool), own_(0), head_(nil), tail_(nil), size_(0)
+// nodes come from (and go back to) pool
+{
+  Init();
+}
+
+template < typename T >
+PoolList<T>::PoolList (Pool * pool)  :  pool_(pool), own_(pool == nullptr), head_(nil), tail_(nil), size_(0)
+// an empty list sharing pool, or with a pool of its own
+{
+  if (own_)
+    pool_ = new Pool;
+  Init();
+}
+
+template < typename T >
+PoolList<T>::PoolList (const PoolList<T>& x)  :  pool_(x.own_ ? new Pool(x.size_ + 2) : x.pool_), own_(x.own_), head_(nil), tail_(nil), size_(0)
+// copy constructor - the copy shares a shared pool of x, or has its own
+{
+  Init();
+  Append(x);
+}
+
+template < typename T >
+PoolList<T>::PoolList (PoolList<T>&& x)  :  pool_(x.pool_), own_(x.own_), head_(x.head_), tail_(x.tail_), size_(x.size_)
+// move constructor - takes the nodes of x, and its pool if its own, and leaves x empty
+{
+  if (x.own_)
+    x.pool_ = new Pool;
+  x.Init();
+}
+
+template < typename T >
+PoolList<T>::~PoolList ()
+// destructor
+{
+  Release();
+  if (own_)
+    delete pool_;
+}
+
+template < typename T >
+PoolList<T>& PoolList<T>::operator = (const PoolList<T>& rhs)
+// assignment operator - existing nodes are reused, so only the difference
+// in length is allocated or deleted
+{
+  if (this != &rhs)   // it would be a disaster to assign to self!
+  {
+    // First, overwrite the elements already on the list.
+    Index curr = Next(head_);
+    Index from = rhs.Next(rhs.head_);
+    for ( ; curr != tail_ && from != rhs.tail_; curr = Next(curr), from = rhs.Next(from))
+      Tval(curr) = rhs.Tval(from);
+    // then delete the surplus nodes, or append copies of the rest of rhs
+    while (curr != tail_)
+    {
+      curr = Next(curr);
+      DeleteNode(LinkOut(Prev(curr)));
+      --size_;
+    }
+    for ( ; from != rhs.tail_; from = rhs.Next(from))
+      PushBack(rhs.Tval(from));
+  }
+  return *this;
+}
+
+template < typename T >
+PoolList<T>& PoolList<T>::operator = (PoolList<T>&& rhs)
+// move assignment - exchanges nodes (and pools) with rhs, which takes the old elements
+{
+  std::swap(pool_,rhs.pool_);
+  std::swap(own_,rhs.own_);
+  std::swap(head_,rhs.head_);
+  std::swap(tail_,rhs.tail_);
+  std::swap(size_,rhs.size_);
+  return *this;
+}
+
+template < typename T >
+PoolList<T>& PoolList<T>::operator += (const PoolList<T>& list)
+// append operator
+{
+  if (this != &list)
+    Append(list);
+  return *this;
+}
+
+template < typename T >
+bool PoolList<T>::PushFront (const T& t)
+// Insert t at the front (first) position.
+{
+  return EmplaceFront(t);
+}
+
+template < typename T >
+bool PoolList<T>::PushBack (const T& t)
+// Insert t at the back (last) position.
+{
+  return EmplaceBack(t);
+}
+
+template < typename T >
+PoolListIterator<T> PoolList<T>::Insert (PoolListIterator<T> i, const T& t)
+// Insert t at (in front of) i; return i at new element
+{
+  return Emplace(i,t);
+}
+
+template < typename T >
+ConstPoolListIterator<T> PoolList<T>::Insert (ConstPoolListIterator<T> i, const T& t)
+// Insert t at (in front of) i; return i at new element
+{
+  return Emplace(Iterator(i.pool_,i.curr_),t);
+}
+
+template < typename T >
+PoolListIterator<T> PoolList<T>::Insert  (const T& t)
+// Insert t at default location (back)
+{
+  return Insert(End(),t);
+}
+
+template < typename T >
+bool PoolList<T>::PushFront (T&& t)
+{
+  return EmplaceFront(std::move(t));
+}
+
+template < typename T >
+bool PoolList<T>::PushBack (T&& t)
+{
+  return EmplaceBack(std::move(t));
+}
+
+template < typename T >
+PoolListIterator<T> PoolList<T>::Insert (PoolListIterator<T> i, T&& t)
+{
+  return Emplace(i,std::move(t));
+}
+
+template < typename T >
+template < class... Args >
+bool PoolList<T>::EmplaceFront (Args&&... args)
+// Construct a new element at the front (first) position.
+{
+  Index newNode = NewNode(std::forward<Args>(args)...);
+  if (newNode == nil) return 0;
+  LinkIn(Next(head_),newNode);
+  ++size_;
+  return 1;
+}
+
+template < typename T >
+template < class... Args >
+bool PoolList<T>::EmplaceBack (Args&&... args)
+// Construct a new element at the back (last) position.
+{
+  Index newNode = NewNode(std::forward<Args>(args)...);
+  if (newNode == nil) return 0;
+  LinkIn(tail_,newNode);
+  ++size_;
+  return 1;
+}
+
+template < typename T >
+template < class... Args >
+PoolListIterator<T> PoolList<T>::Emplace (PoolListIterator<T> i, Args&&... args)
+// Construct a new element at (in front of) i; return i at new element
+{
+  if (Empty())  // always insert
+  {
+    i = End();
+  }
+  if (!i.Valid() || i == rEnd()) // null or off-the-front
+  {
+    std::cerr << " ** cannot insert at position -1\n";
+    return End();
+  }
+  Index newNode = NewNode(std::forward<Args>(args)...);
+  if (newNode == nil) return End();
+  LinkIn(i.curr_,newNode);
+  ++size_;
+  // leave i at new entry and return
+  i.curr_ = newNode;
+  return i;
+}
+
+template < typename T >
+bool PoolList<T>::PopFront()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopFront() called on empty list\n";
+    return 0;
+  }
+  DeleteNode(LinkOut(Next(head_)));
+  --size_;
+  return 1;
+} // end PopFront()
+
+template < typename T >
+bool PoolList<T>::PopBack()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopBack() called on empty list\n";
+    return 0;
+  }
+  DeleteNode(LinkOut(Prev(tail_)));
+  --size_;
+  return 1;
+} // end PopBack()
+
+template < typename T >
+PoolListIterator<T> PoolList<T>::Remove (Iterator i)
+// Remove item at i
+{
+  // first deal with the impossible cases
+  if (i.curr_ == nil || i.curr_ == head_ || i.curr_ == tail_)
+  {
+    std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
+    return i;
+  }
+  i.curr_ = Next(i.curr_);                   // advance iterator
+  DeleteNode(LinkOut(Prev(i.curr_)));        // unlink and delete the element
+  --size_;
+  return i;                                  // return i at new position
+} // end Remove(Iterator)
+
+template < typename T >
+ConstPoolListIterator<T> PoolList<T>::Remove (ConstIterator i)
+// Remove item at i
+{
+  return Remove(Iterator(i.pool_,i.curr_));
+} // end Remove(ConstIterator)
+
+template < typename T >
+size_t  PoolList<T>::Remove (const T& t)
+// Remove all copies of t
+{
+  size_t count(0);
+  Index i = Next(head_);
+  while (i != tail_)
+  {
+    if (t == Tval(i))
+    {
+      i = Next(i);
+      DeleteNode(LinkOut(Prev(i)));
+      --size_;
+      ++count;
+    }
+    else
+      i = Next(i);
+  }
+  return (count);
+}  // end Remove(t)
+
+template < typename T >
+void PoolList<T>::Clear()
+// Makes list empty
+{
+  while (!Empty())
+    PopFront();
+} // end Clear()
+
+template < typename T >
+void PoolList<T>::Release()
+// Deletes all nodes
+{
+  Clear();
+  DeleteNode(head_);
+  DeleteNode(tail_);
+} // end Release()
+
+template < typename T >
+PoolList<T> * PoolList<T>::Clone() const
+// returns pointer to a copy of *this
+{
+  PoolList * clone = new PoolList(own_ ? nullptr : pool_);
+  clone->Append(*this);
+  return clone;
+}
+
+// accessors
+
+template < typename T >
+size_t PoolList<T>::Size()  const
+{
+  return size_;
+}
+
+template < typename T >
+bool PoolList<T>::Empty()  const
+{
+  return (Next(head_) == tail_);
+}
+
+template < typename T >
+ListStats PoolList<T>::Stats() const
+{
+  ListStats s;
+  s.elements    = size_;
+  s.links       = size_;
+  s.spares      = own_ ? pool_->Capacity() - pool_->InUse() : 0;
+  s.sentinels   = 2;
+  s.linkBytes   = (s.links + s.spares + s.sentinels) * sizeof(Node);
+  s.objectBytes = sizeof(*this) + (own_ ? sizeof(Pool) : 0);
+  if (PayloadBytes<T>::deep)
+    for (Index i = Next(head_); i != tail_; i = Next(i))
+      s.payloadBytes += PayloadBytes<T>::Bytes(Tval(i));
+  return s;
+}
+
+template < typename T >
+size_t PoolList<T>::MemoryUsage() const
+{
+  return Stats().Bytes();
+}
+
+template < typename T >
+T& PoolList<T>::Front ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T >
+const T& PoolList<T>::Front () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T >
+T& PoolList<T>::Back  ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+template < typename T >
+const T& PoolList<T>::Back  () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+template < typename T >
+PoolListIterator<T>  PoolList<T>::Includes (const T& t)
+// sequential search
+{
+  Index i = Next(head_);
+  while (i != tail_ && !(t == Tval(i)))
+    i = Next(i);
+  return Iterator(pool_,i);
+} // Includes()
+
+// output methods
+
+template < typename T >
+void PoolList<T>::Display (std::ostream& os, char ofc) const
+{
+  ConstIterator i;
+  if (ofc == '\0')
+    for (i = Begin(); i != End(); ++i)
+      os << *i;
+  else
+    for (i = Begin(); i != End(); ++i)
+      os << ofc << *i;
+} // Display()
+
+// debug/developer methods
+
+template < typename T >
+void PoolList<T>::Dump (std::ostream& os, char ofc) const
+{
+  Display(os,ofc);
+  os << '\n';
+} // Dump()
+
+template < typename T >
+void PoolList<T>::CheckLinks(std::ostream& os) const
+{
+  // node structure: indices in range and reciprocal, count
+  size_t n = 0;
+  Index i;
+  for (i = head_; i != tail_; i = Next(i), ++n)
+  {
+    Index j = Next(i);
+    if (j >= pool_->used_ || Prev(j) != i)
+    {
+      os << " ** node link failure at position " << n << '\n';
+      return;
+    }
+  }
+  if (n != Size() + 1)
+  {
+    os << " ** Size() mismatch: count = " << n - 1 << " , size = " << Size() << '\n';
+  }
+
+  // iterator reciprocity
+  typename PoolList<T>::ConstIterator p,q,r;
+  for (p = this->Begin(), n = 0; p != this->End(); ++p, ++n)
+  {
+    q = p; --q; ++q;
+    r = p; ++r; --r;
+    if (!p.Valid() || !q.Valid() || !r.Valid() || p != q || p != r)
+    {
+      os << " ** forward reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+  for (p = this->rBegin(), n = Size(); p != this->rEnd(); --p, --n)
+  {
+    q = p; --q; ++q;
+    r = p; ++r; --r;
+    if (!p.Valid() || !q.Valid() || !r.Valid() || p != q || p != r)
+    {
+      os << " ** reverse reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+} // CheckLinks()
+
+// Iterator support
+
+template < typename T >
+PoolListIterator<T>  PoolList<T>::Begin()
+{
+  return Iterator(pool_,Next(head_));
+}
+
+template < typename T >
+PoolListIterator<T>  PoolList<T>::End()
+{
+  return Iterator(pool_,tail_);
+}
+
+template < typename T >
+PoolListIterator<T>  PoolList<T>::rBegin()
+{
+  return Iterator(pool_,Prev(tail_));
+}
+
+template < typename T >
+PoolListIterator<T>  PoolList<T>::rEnd ()
+{
+  return Iterator(pool_,head_);
+}
+
+// ConstIterator support
+
+template < typename T >
+ConstPoolListIterator<T>  PoolList<T>::Begin() const
+{
+  return ConstIterator(pool_,Next(head_));
+}
+
+template < typename T >
+ConstPoolListIterator<T>  PoolList<T>::End() const
+{
+  return ConstIterator(pool_,tail_);
+}
+
+template < typename T >
+ConstPoolListIterator<T>  PoolList<T>::rBegin() const
+{
+  return ConstIterator(pool_,Prev(tail_));
+}
+
+template < typename T >
+ConstPoolListIterator<T>  PoolList<T>::rEnd () const
+{
+  return ConstIterator(pool_,head_);
+}
+
+template < typename T >
+ConstPoolListIterator<T>  PoolList<T>::Includes (const T& t) const
+{
+  Index i = Next(head_);
+  while (i != tail_ && !(t == Tval(i)))
+    i = Next(i);
+  return ConstIterator(pool_,i);
+} // Includes()
+
+//-------------------------------------------
+//     ConstPoolListIterator<T>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T >
+ConstPoolListIterator<T>::ConstPoolListIterator ()  :  pool_(nullptr), curr_(PoolList<T>::nil)
+// construct a null ConstPoolListIterator
+{}
+
+// protected constructor
+template < typename T >
+ConstPoolListIterator<T>::ConstPoolListIterator (typename PoolList<T>::Pool * pool, typename PoolList<T>::Index i)
+  : pool_(pool), curr_(i)
+// construct an iterator around a node index (not available to client programs)
+{}
+
+// copy constructor
+template < typename T >
+ConstPoolListIterator<T>::ConstPoolListIterator (const ConstPoolListIterator<T>& i)
+  :  pool_(i.pool_), curr_(i.curr_)
+{}
+
+// assignment operator
+template < typename T >
+ConstPoolListIterator<T>& ConstPoolListIterator<T>::operator = (const ConstPoolListIterator<T>& i)
+{
+  pool_ = i.pool_;
+  curr_ = i.curr_;
+  return *this;
+}
+
+// protected method
+template < typename T >
+T&  ConstPoolListIterator<T>::Retrieve() const
+// Return reference to current t
+// note conflicted signature - const method returns non-const reference
+{
+  if (curr_ == PoolList<T>::nil)
+  {
+    std::cerr << "** Error: ConstPoolListIterator<T>::Retrieve() invalid dereference\n";
+    exit (EXIT_FAILURE);
+  }
+  return *(*pool_)[curr_].Tval();
+}
+
+template < typename T >
+bool ConstPoolListIterator<T>::Valid() const
+// test cursor for legal dereference
+{
+  return curr_ != PoolList<T>::nil;
+}
+
+template < typename T >
+bool ConstPoolListIterator<T>::operator == (const ConstPoolListIterator<T>& i2) const
+{
+  return curr_ == i2.curr_ && (pool_ == i2.pool_ || curr_ == PoolList<T>::nil);
+}
+
+template < typename T >
+bool ConstPoolListIterator<T>::operator != (const ConstPoolListIterator<T>& i2) const
+{
+  return !(*this == i2);
+}
+
+template < typename T >
+const T&  ConstPoolListIterator<T>::operator * () const
+{
+  return Retrieve();
+}
+
+template < typename T >
+ConstPoolListIterator<T>& ConstPoolListIterator<T>::operator ++ ()
+// prefix increment
+{
+  if (curr_ != PoolList<T>::nil)
+    curr_ = (*pool_)[curr_].next_;
+  return *this;
+}
+
+template < typename T >
+ConstPoolListIterator<T> ConstPoolListIterator<T>::operator ++ (int)
+// postfix increment
+{
+  ConstPoolListIterator<T> clone = *this;
+  this->operator++();
+  return clone;
+}
+
+template < typename T >
+ConstPoolListIterator<T>& ConstPoolListIterator<T>::operator -- ()
+// prefix decrement
+{
+  if (curr_ != PoolList<T>::nil)
+    curr_ = (*pool_)[curr_].prev_;
+  return *this;
+}
+
+template < typename T >
+ConstPoolListIterator<T> ConstPoolListIterator<T>::operator -- (int)
+// postfix decrement
+{
+  ConstPoolListIterator<T> clone = *this;
+  this->operator--();
+  return clone;
+}
+
+//-------------------------------------------
+//     PoolListIterator<T>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T >
+PoolListIterator<T>::PoolListIterator ()  :  ConstPoolListIterator<T>()
+// construct a null PoolListIterator
+{}
+
+// initializing constructor
+template < typename T >
+PoolListIterator<T>::PoolListIterator (PoolList<T>& x)  :  ConstPoolListIterator<T>(x.pool_,x.Next(x.head_))
+// iterator at the front of x
+{}
+
+// protected constructor
+template < typename T >
+PoolListIterator<T>::PoolListIterator (typename PoolList<T>::Pool * pool, typename PoolList<T>::Index i)
+  : ConstPoolListIterator<T>(pool,i)
+// construct an iterator around a node index (not available to client programs)
+{}
+
+// copy constructor
+template < typename T >
+PoolListIterator<T>::PoolListIterator (const PoolListIterator<T>& i)
+  :  ConstPoolListIterator<T>(i)
+{}
+
+// assignment operator
+template < typename T >
+PoolListIterator<T>& PoolListIterator<T>::operator = (const PoolListIterator<T>& i)
+{
+  ConstPoolListIterator<T>::operator=(i);
+  return *this;
+}
+
+template < typename T >
+const T&  PoolListIterator<T>::operator * () const
+{
+  return ConstPoolListIterator<T>::Retrieve();
+}
+
+template < typename T >
+T&  PoolListIterator<T>::operator * ()
+{
+  return ConstPoolListIterator<T>::Retrieve();
+}
+
+template < typename T >
+PoolListIterator<T>& PoolListIterator<T>::operator ++ ()
+// prefix increment
+{
+  ConstPoolListIterator<T>::operator++();
+  return *this;
+}
+
+template < typename T >
+PoolListIterator<T> PoolListIterator<T>::operator ++ (int)
+// postfix increment
+{
+  PoolListIterator<T> clone = *this;
+  this->operator++();
+  return clone;
+}
+
+template < typename T >
+PoolListIterator<T>& PoolListIterator<T>::operator -- ()
+// prefix decrement
+{
+  ConstPoolListIterator<T>::operator--();
+  return *this;
+}
+
+template < typename T >
+PoolListIterator<T> PoolListIterator<T>::operator -- (int)
+// postfix decrement
+{
+  PoolListIterator<T> clone = *this;
+  this->operator--();
+  return clone;
+}
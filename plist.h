@@ -0,0 +1,367 @@
+/*
+    plist.h
+    Andrew J Wood
+
+    Definition of the fsu::PoolList<T> API
+
+    A doubly linked list whose nodes live in one growable contiguous array
+    (the Pool) and are linked by 32-bit indices into it instead of pointers.
+    On a 64-bit build a node costs sizeof(T) plus 8 bytes, instead of
+    sizeof(T) plus 16 for a Link of fsu::List, and nodes allocated together
+    are adjacent in memory, so traversals of a list built in order run over
+    contiguous storage. The public interface is that of fsu::List<T>
+    (list.h), so a client can switch between the two with a single typedef:
+
+      typedef fsu::List < ElementType >      ContainerType;
+      typedef fsu::PoolList < ElementType >  ContainerType;
+
+    Iterators hold an index and the pool, so they stay attached to their
+    elements, as for fsu::List, when the array grows [1].
+*/
+
+#ifndef _PLIST_H
+#define _PLIST_H
+
+#include <iostream>    // class ostream and objects cerr, cout
+#include <cstdlib>     // EXIT_FAILURE, size_t
+#include <cstdint>     // uint32_t
+#include <new>         // placement new, std::nothrow
+#include <type_traits> // std::aligned_storage
+#include <utility>     // std::move, std::forward, std::swap
+#include <compare.h>   // needed for Sort()
+#include <liststats.h> // ListStats, PayloadBytes
+
+namespace fsu
+{
+
+  template < typename T >
+  class PoolList;
+
+  template < typename T >
+  class ConstPoolListIterator;
+
+  template < typename T >
+  class PoolListIterator;
+
+  //----------------------------------
+  //     PoolList<T>
+  //----------------------------------
+
+  template < typename T >
+  class PoolList
+  {
+  protected:
+    class Node; // defined below
+    typedef uint32_t Index;  // position of a node in the pool array [2]
+    static const Index nil = 0xFFFFFFFF;  // the null index
+
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef PoolListIterator < T >                 Iterator;
+    typedef ConstPoolListIterator < T >            ConstIterator;
+
+    // the node array; it may be shared by several lists [3]
+    class Pool
+    {
+    public:
+      explicit Pool (size_t capacity = 0); // room for capacity nodes before the array first grows
+      ~Pool ();
+
+      size_t Blocks   () const; // number of arrays held: 1, or 0 before the first node
+      size_t InUse    () const; // number of nodes currently handed out
+      size_t Capacity () const; // number of nodes the array holds
+
+    private:
+      friend class PoolList<T>;
+      friend class ConstPoolListIterator<T>;
+
+      static const Index freeMark = 0xFFFFFFFE; // prev_ of a node on the free list
+      static const Index maxNodes = 0xFFFFFFFE; // indices 0 .. maxNodes - 1
+
+      Node *  nodes_;    // the array
+      Index   capacity_, // number of nodes in the array
+              used_,     // nodes 0 .. used_ - 1 have been handed out at some time
+              free_,     // free list of recycled nodes, chained through next_
+              inUse_;    // number of nodes handed out and not returned
+
+      template < class... Args >
+      Index  Allocate   (Args&&... args); // a node holding T(args...), or nil on failure
+      void   Deallocate (Index i);
+
+      Node&  operator [] (Index i) const { return nodes_[i]; }
+
+      Pool (const Pool& ) = delete;
+      Pool& operator = (const Pool& ) = delete;
+    } ;
+
+    // constructors and assignment
+                   PoolList       ();                  // default constructor; the list has its own pool
+    explicit       PoolList       (Pool& pool);        // nodes allocated from a shared pool [3]
+    virtual        ~PoolList      ();                  // destructor
+                   PoolList       (const PoolList& );  // copy constructor
+                   PoolList       (PoolList&& );       // move constructor
+    PoolList&      operator =     (const PoolList& );  // assignment
+    PoolList&      operator =     (PoolList&& );       // move assignment
+    virtual PoolList * Clone      () const;            // returns ptr to deep copy of this list
+
+    // modifying List structure - mutators
+    bool      PushFront  (const T& t);   // Insert t at front of list
+    bool      PushBack   (const T& t);   // Insert t at back of list
+    Iterator  Insert     (Iterator i, const T& t);  // Insert t at i
+    ConstIterator  Insert     (ConstIterator i, const T& t);  // ConstIterator version
+    Iterator  Insert     (const T& t);   // Insert t at back
+    PoolList& operator+= (const PoolList& list); // append list
+
+    // move and in-place versions of the inserting mutators
+    bool      PushFront  (T&& t);
+    bool      PushBack   (T&& t);
+    Iterator  Insert     (Iterator i, T&& t);
+    template < class... Args >
+    bool      EmplaceFront (Args&&... args);  // construct T(args...) at front
+    template < class... Args >
+    bool      EmplaceBack  (Args&&... args);  // construct T(args...) at back
+    template < class... Args >
+    Iterator  Emplace      (Iterator i, Args&&... args); // construct T(args...) at i
+
+    bool      PopFront  ();              // Remove the Tval at front
+    bool      PopBack   ();              // Remove the Tval at back
+    Iterator  Remove    (Iterator i);    // Remove item at i
+    ConstIterator  Remove    (ConstIterator i);    // ConstIterator version
+    size_t    Remove    (const T& t);    // Remove all copies of t
+    void      Clear     ();              // Make the list empty
+    void      Release   ();              // Release all allocated memory
+
+    // macroscopic (whole list) mutators
+    void      Sort      ();               // default order <
+    void      Merge     (PoolList& list);  // merges "list" into this list
+    void      Reverse   ();
+    void      Shuffle   ();
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Sort      (Predicate& p);
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Merge     (PoolList& list, Predicate& p);
+
+    // moving elements between lists without copying them [3]
+    void      Splice    (Iterator pos, PoolList& list);             // all of list, ahead of pos
+    void      Splice    (Iterator pos, PoolList& list, Iterator i); // element i of list
+    void      Splice    (Iterator pos, PoolList& list, Iterator first, Iterator last); // [first,last)
+
+    // information about the list - accessors
+    size_t    Size  () const;  // return the number of elements on the list
+    bool      Empty () const;  // true iff list has no elements
+
+    // memory held by the list [4]
+    ListStats Stats       () const;  // nodes, sentinels and bytes by kind
+    size_t    MemoryUsage () const;  // Stats().Bytes()
+
+    // accessing values on the list - more accessors [1]
+    T&        Front ();        // return reference to Tval at front of list
+    const T&  Front () const;  // const version
+    T&        Back  ();        // return reference to Tval at back of list
+    const T&  Back  () const;  // const version
+
+    // Iterator support - locating places on the list
+    Iterator  Begin      (); // return iterator to front
+    Iterator  End        (); // return iterator "1 past the back"
+    Iterator  rBegin     (); // return iterator to back
+    Iterator  rEnd       (); // return iterator "1 past the front" in reverse
+    Iterator  Includes   (const T& t); // returns position of first occurrence of t, or End()
+
+    // ConstIterator support
+    ConstIterator  Begin      () const;
+    ConstIterator  End        () const;
+    ConstIterator  rBegin     () const;
+    ConstIterator  rEnd       () const;
+    ConstIterator  Includes   (const T& t) const;
+
+    // generic display methods
+    void Display (std::ostream& os, char ofc = '\0') const;
+    void Dump    (std::ostream& os, char ofc = '\0') const;
+
+    // structural integrity check
+    void CheckLinks(std::ostream& os = std::cout) const;
+
+  protected:
+    // a node of the pool array; Tval_ is constructed only while the node is handed out
+    class Node
+    {
+      friend class PoolList<T>;
+      friend class ConstPoolListIterator<T>;
+
+      // Node variables
+      typename std::aligned_storage < sizeof(T), alignof(T) >::type data_;
+      Index   prev_;        // index of predecessor Node
+      Index   next_;        // index of successor Node
+
+      T* Tval () { return reinterpret_cast < T* > (&data_); }
+    } ;
+
+    Pool *  pool_;  // node array of this list
+    bool    own_;   // true iff pool_ belongs to this list alone
+    Index   head_,  // node representing "one before the first"
+            tail_;  // node representing "one past the last"
+    size_t  size_;  // number of elements on the list
+
+    // protected methods -- used only by other methods
+    explicit PoolList (Pool * pool); // list sharing pool, or with its own when pool is nullptr
+    void Init   ();                  // sets up head and tail nodes
+    void Append (const PoolList& list); // append deep copy of list
+
+    // node access; a reference is good only until the next allocation from the pool
+    T&      Tval (Index i) const { return *(*pool_)[i].Tval(); }
+    Index&  Prev (Index i) const { return (*pool_)[i].prev_; }
+    Index&  Next (Index i) const { return (*pool_)[i].next_; }
+
+    // protected methods isolate memory allocation and associated error handling
+    template < class... Args >
+    Index  NewNode    (Args&&... args);
+    void   DeleteNode (Index oldNode);
+
+    // append copies of the elements [first,last) of list y, of another pool, removing them from y [3]
+    bool   Adopt      (PoolList& y, Index first, Index last);
+
+    // standard link-in and link-out processes
+    void   LinkIn   (Index location, Index newNode);
+    Index  LinkOut  (Index oldNode);
+    void   Transfer (Index location, Index first, Index last); // [first,last) ahead of location
+
+    // tight couplings
+    friend class PoolListIterator<T>;
+    friend class ConstPoolListIterator<T>;
+  } ;
+
+  // global scope operators and functions
+
+  template < typename T >
+  bool operator == (const PoolList<T>& list1, const PoolList<T>& list2);
+
+  template < typename T >
+  bool operator != (const PoolList<T>& list1, const PoolList<T>& list2);
+
+  template < typename T >
+  std::ostream& operator << (std::ostream& os, const PoolList<T>& list);
+
+  //----------------------------------
+  //     ConstPoolListIterator<T>
+  //----------------------------------
+
+  template < typename T >
+  class ConstPoolListIterator
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstPoolListIterator < T >            ConstIterator;
+    typedef PoolListIterator < T >                 Iterator;
+
+    // constructors
+    ConstPoolListIterator       ();                              // default constructor
+    ConstPoolListIterator       (const ConstPoolListIterator& ); // copy constructor
+
+    // information/access
+    bool Valid         () const;  // cursor is valid element
+
+    // various operators
+    bool            operator == (const ConstIterator& i2) const;
+    bool            operator != (const ConstIterator& i2) const;
+    const T&        operator *  () const; // Return const reference to current Tval
+    ConstIterator&  operator =  (const ConstIterator& i);
+    ConstIterator&  operator ++ ();    // prefix
+    ConstIterator   operator ++ (int); // postfix
+    ConstIterator&  operator -- ();    // prefix
+    ConstIterator   operator -- (int); // postfix
+
+  protected:
+    // data: node curr_ of pool pool_
+    typename PoolList<T>::Pool *  pool_;
+    typename PoolList<T>::Index   curr_;
+
+    // methods
+    ConstPoolListIterator (typename PoolList<T>::Pool * pool, typename PoolList<T>::Index i); // type converting constructor
+    T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
+
+    // tight couplings
+    friend class PoolList<T>;
+  } ;
+
+  //----------------------------------
+  //     PoolListIterator<T>
+  //----------------------------------
+
+  template < typename T >
+  class PoolListIterator : public ConstPoolListIterator<T>
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstPoolListIterator < T >            ConstIterator;
+    typedef PoolListIterator < T >                 Iterator;
+
+    // constructors
+    PoolListIterator       ();                           // default constructor
+    PoolListIterator       (PoolList<T>& );              // initializing constructor
+    PoolListIterator       (const PoolListIterator& );   // copy constructor
+
+    // various operators
+    T&         operator *  ();       // Return reference to current Tval
+    const T&   operator *  () const; // const version
+    Iterator&  operator =  (const Iterator& i);
+    Iterator&  operator ++ ();    // prefix
+    Iterator   operator ++ (int); // postfix
+    Iterator&  operator -- ();    // prefix
+    Iterator   operator -- (int); // postfix
+
+  protected:
+    // methods
+    PoolListIterator (typename PoolList<T>::Pool * pool, typename PoolList<T>::Index i); // type converting constructor
+
+    // tight couplings
+    friend class PoolList<T>;
+  } ;
+
+#include <plist.cpp>
+#include <plist_macro.cpp>
+
+} // namespace fsu
+
+/* Notes
+   =====
+
+[1] The pool array grows by doubling, moving every element to the new
+    array, so T must be move constructible. Iterators are (pool, index)
+    pairs and survive the move, and Pop, Remove, Sort, Merge, Splice and
+    the other mutators leave iterators to other elements legitimate, as for
+    fsu::List. References and pointers to elements, such as those returned
+    by Front(), Back() and operator*, are not iterators: any push, insert,
+    copy or Clone that allocates from the pool may move the element and
+    make them dangle. An element of the pool passed to a push or insert is
+    safe; the new element is constructed before the old ones move.
+
+[2] A 32-bit index limits a pool to 2^32 - 2 nodes, head and tail nodes
+    included. An allocation beyond that fails as for an allocation failure:
+    with a message and the failure value of the operation.
+
+[3] A list constructed without a Pool has one of its own, so its nodes are
+    contiguous no matter what other lists do. Lists constructed with a
+    shared pool take their nodes (including head_ and tail_) from it:
+
+      fsu::PoolList<T>::Pool pool;
+      fsu::PoolList<T> x(pool), y(pool);
+
+    Copies and Clone() of such a list share its pool, and Merge and Splice
+    relink nodes directly between lists of one pool. When the pools differ,
+    the elements are first copied into nodes of this list's pool, as for
+    fsu::List with different pools. A shared pool must outlive every list
+    that uses it; a pool of its own moves with the list in a move or move
+    assignment.
+
+[4] Stats() counts the nodes of the list and its two sentinels at
+    sizeof(Node) each, and for a list with a pool of its own, the unused
+    nodes of the array as spares. The unused nodes of a shared pool are not
+    counted, since they are not this list's (see liststats.h).
+*/
+
+#endif
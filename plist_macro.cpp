@@ -0,0 +1,314 @@
+/*
+    plist_macro.cpp
+    Andrew J Wood
+
+    slave file to plist.h
+
+    Implementation of PoolList<T>:: macroscopic (whole list) mutators
+    Sort, Merge, Reverse, Shuffle, Splice
+
+    These follow list_macro.cpp and list_sort.cpp, with indices in place of
+    link pointers. Nodes are only relinked, except that elements moving in
+    from a list of another pool are first copied into this list's pool.
+*/
+
+//----------------------------------
+//     PoolList<T>::Sort Implementations
+//----------------------------------
+
+template < typename T >
+template < class P >
+void PoolList<T>::Sort (P& comp)
+// bottom-up merge sort of the nodes, as SortLinks in list_sort.cpp;
+// nothing is allocated, so the array stays put and is addressed directly
+{
+  Node * nodes = pool_->nodes_;
+  if (nodes[head_].next_ == tail_ || nodes[nodes[head_].next_].next_ == tail_)
+    return;
+
+  // detach the elements as a chain of next_ indices terminated by nil
+  Index list = nodes[head_].next_;
+  nodes[nodes[tail_].prev_].next_ = nil;
+
+  Index p, q, e, last;
+  size_t runSize = 1, numMerges, psize, qsize;
+  do
+  {
+    p = list;
+    list = nil;
+    last = nil;
+    numMerges = 0;
+    // merge adjacent pairs of runs of length runSize
+    while (p != nil)
+    {
+      ++numMerges;
+      q = p;
+      for (psize = 0; psize < runSize && q != nil; ++psize)
+        q = nodes[q].next_;
+      qsize = runSize;
+
+      while (psize > 0 || (qsize > 0 && q != nil))
+      {
+        if (psize == 0)                      // p run exhausted
+        {
+          e = q; q = nodes[q].next_; --qsize;
+        }
+        else if (qsize == 0 || q == nil)     // q run exhausted
+        {
+          e = p; p = nodes[p].next_; --psize;
+        }
+        else if (comp(*nodes[q].Tval(),*nodes[p].Tval())) // q < p
+        {
+          e = q; q = nodes[q].next_; --qsize;
+        }
+        else                                 // p <= q: take p first for stability
+        {
+          e = p; p = nodes[p].next_; --psize;
+        }
+        if (last == nil)
+          list = e;
+        else
+          nodes[last].next_ = e;
+        last = e;
+      }
+      p = q;
+    }
+    nodes[last].next_ = nil;
+    runSize *= 2;
+  }
+  while (numMerges > 1);
+
+  // restore prev_ indices and splice the sorted chain between head and tail
+  nodes[head_].next_ = list;
+  nodes[list].prev_ = head_;
+  for (p = list; nodes[p].next_ != nil; p = nodes[p].next_)
+    nodes[nodes[p].next_].prev_ = p;
+  nodes[p].next_ = tail_;
+  nodes[tail_].prev_ = p;
+}
+
+template < typename T >
+void PoolList<T>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
+//-----------------------------------
+//     PoolList<T>::Merge Implementations
+//-----------------------------------
+
+template < typename T >
+template < class P >
+void PoolList<T>::Merge (PoolList<T>& y, P& p)
+// merges y into this list; post: true = y.Empty()
+// if both lists are ordered result is ordered
+{
+  if (this == &y) return;
+  if (pool_ != y.pool_) // merge copies in this pool instead [3]
+  {
+    PoolList<T> moved(pool_);
+    if (moved.Adopt(y,y.Next(y.head_),y.tail_))
+      Merge(moved,p);
+    return;
+  }
+  Index xcurr = Next(head_);     // x = this list
+  Index ycurr = y.Next(y.head_); // y = that list
+
+  // merge while both lists are not empty
+  while (xcurr != tail_ && ycurr != y.tail_)
+  {
+    if (p(Tval(ycurr),Tval(xcurr))) // y < x
+    {
+      ycurr = Next(ycurr);
+      Transfer(xcurr,Prev(ycurr),ycurr);
+    }
+    else // x <= y
+    {
+      xcurr = Next(xcurr);
+    }
+  }
+
+  // splice in remainder of y
+  if (ycurr != y.tail_)
+    Transfer(tail_,ycurr,y.tail_);
+
+  // all of y's elements now belong to this list
+  size_ += y.size_;
+  y.size_ = 0;
+}
+
+template < typename T >
+void PoolList<T>::Merge (PoolList<T>& y)
+{
+  fsu::LessThan<T> p;
+  Merge(y,p);
+}
+
+template < typename T >
+bool PoolList<T>::Adopt (PoolList<T>& y, Index first, Index last)
+// append copies of the elements of y in [first,last) and remove them from y;
+// on allocation failure both lists are left as they were
+{
+  size_t n = 0;
+  for (Index i = first; i != last; i = y.Next(i), ++n)
+  {
+    if (!PushBack(y.Tval(i)))
+    {
+      for ( ; n > 0; --n)
+        PopBack();
+      return 0;
+    }
+  }
+  while (first != last)
+  {
+    first = y.Next(first);
+    y.DeleteNode(y.LinkOut(y.Prev(first)));
+    --y.size_;
+  }
+  return 1;
+}
+
+//------------------------------------
+//     PoolList<T>::Splice Implementations
+//------------------------------------
+
+template < typename T >
+void PoolList<T>::Splice (Iterator pos, PoolList<T>& y)
+// moves all elements of y ahead of pos; post: y.Empty()
+{
+  if (this == &y || y.Next(y.head_) == y.tail_) return;
+  if (!pos.Valid() || pos.curr_ == head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid position\n";
+    return;
+  }
+  if (pool_ != y.pool_)
+  {
+    PoolList<T> moved(pool_);
+    if (moved.Adopt(y,y.Next(y.head_),y.tail_))
+      Splice(pos,moved);
+    return;
+  }
+  Transfer(pos.curr_,y.Next(y.head_),y.tail_);
+  size_ += y.size_;
+  y.size_ = 0;
+}
+
+template < typename T >
+void PoolList<T>::Splice (Iterator pos, PoolList<T>& y, Iterator i)
+// moves the element at i in y ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == head_ || !i.Valid() || i.curr_ == y.head_ || i.curr_ == y.tail_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (pool_ != y.pool_)
+  {
+    PoolList<T> moved(pool_);
+    if (moved.Adopt(y,i.curr_,y.Next(i.curr_)))
+      Splice(pos,moved);
+    return;
+  }
+  if (pos.curr_ == i.curr_ || pos.curr_ == Next(i.curr_)) return; // already in place
+  Transfer(pos.curr_,i.curr_,Next(i.curr_));
+  ++size_;
+  --y.size_;
+}
+
+template < typename T >
+void PoolList<T>::Splice (Iterator pos, PoolList<T>& y, Iterator first, Iterator last)
+// moves the elements of y in [first,last) ahead of pos
+{
+  if (!pos.Valid() || pos.curr_ == head_ || !first.Valid() || !last.Valid() || first.curr_ == y.head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (first == last || pos == first || pos == last) return; // nothing to move, or already in place
+  if (pool_ != y.pool_)
+  {
+    PoolList<T> moved(pool_);
+    if (moved.Adopt(y,first.curr_,last.curr_))
+      Splice(pos,moved);
+    return;
+  }
+  if (this != &y)
+  {
+    size_t n = 0;
+    for (Index i = first.curr_; i != last.curr_; i = Next(i))
+      ++n;
+    size_ += n;
+    y.size_ -= n;
+  }
+  Transfer(pos.curr_,first.curr_,last.curr_);
+}
+
+//------------------------------------
+//     PoolList<T>::Reverse Implementation
+//------------------------------------
+
+template < typename T >
+void PoolList<T>::Reverse ()
+{
+  if (Next(head_) == tail_)
+    return;
+
+  // swap prev_ and next_ for each node
+  Index i(head_), temp(nil);
+  while (i != nil)
+  {
+    temp    = Next(i);
+    Next(i) = Prev(i);
+    Prev(i) = temp;
+    i       = temp; // move to "old next" = Prev(i)
+  }
+  // swap head_ and tail_
+  std::swap(head_,tail_);
+}
+
+//------------------------------------
+//     PoolList<T>::Shuffle Implementation
+//------------------------------------
+
+template < typename T >
+void PoolList<T>::Shuffle ()
+// the permutation of List<T>::Shuffle: every 2nd and 3rd element is moved,
+// in reverse order, to the front
+{
+  if (Next(head_) == tail_ || Next(Next(head_)) == tail_)
+    return;
+  char  toggle = 0;
+
+  // relink nodes instead of using API which would allocate
+  PoolList<T> aux1(pool_), aux2(pool_);
+  Index i = Next(head_);
+  Index node;
+  while (i != tail_)
+  {
+    toggle == 2 ? toggle = 0 : toggle += 1;
+    if (toggle == 0)
+    {
+      i = Next(i);                   // leave in List
+    }
+    else
+    {
+      node = i;
+      i = Next(i);
+      node = LinkOut(node);
+      if (toggle == 1)
+        aux1.LinkIn(Next(aux1.head_),node); // aux1.PushFront
+      else
+        aux2.LinkIn(Next(aux2.head_),node); // aux2.PushFront
+    }
+  }
+
+  // splice aux2, then aux1, to the front of the list; aux lists are left empty
+  if (Next(aux2.head_) != aux2.tail_)
+    Transfer(Next(head_),Next(aux2.head_),aux2.tail_);
+  if (Next(aux1.head_) != aux1.tail_)
+    Transfer(Next(head_),Next(aux1.head_),aux1.tail_);
+}
+
+// end macromutators */
@@ -0,0 +1,177 @@
+/*
+    retention.h
+    Andrew J Wood
+
+    Definition of the retention policies alt2c::KeepAll,
+    alt2c::FractionRetention and alt2c::DecayRetention
+
+    A retention policy is the fourth template argument of alt2c::List<T,I,A,R>.
+    It decides how many of the unused links of the ring the list gives back
+    to its allocator. Each list holds one policy object, retain_, reached
+    through Retention(), and calls it as follows:
+
+      Trim       (size, excess)  after PopFront, PopBack or Remove: the number
+                                 of unused links to free now
+      Grow       (size)          before a push or insert into a full ring: the
+                                 number of unused links to add, at least 1
+      Allocated  (n = 1)         the list has allocated n links in one call
+      Freed      (n)             the list has freed n links on Trim's advice,
+                                 or moved n links to a new block (list2c.h [4])
+
+    The list frees the unused links nearest the tail, as ShrinkToFit does. A
+    policy should answer 0 most of the time and then free a batch, so that a
+    list hovering around one size neither allocates nor frees on every
+    operation. Grow should likewise stay below what the next Trim would free,
+    or a list pushing and popping at a full ring would add a batch and free
+    it again on every cycle. RetentionCounts::Grow adds Size()/2 + 1 links,
+    so a list pushed to n elements makes O(log n) calls to its allocator,
+    each for one block of links, and holds at most about n/2 unused links.
+
+    KeepAll never frees a link, so the ring keeps every link it has held;
+    that was the only behaviour before there were policies, and it is the
+    default. It grows a full ring as RetentionCounts does, by half.
+    FractionRetention(f,batch) keeps up to f x Size() unused links.
+    Once the excess is batch links over that, it frees down to f x Size(); a
+    full ring grows by f x Size() links.
+    DecayRetention(period,batch) remembers the largest size the list has
+    reached and keeps enough unused links to get back to it. Every period
+    removals, the remembered size moves halfway to the current size. After
+    a spike the ring therefore shrinks over a few periods rather than at
+    once, and a list that spikes regularly keeps its links. Time is counted
+    in removals rather than read from a clock, so runs repeat exactly. It
+    grows a full ring by half, as RetentionCounts does, and raises the
+    remembered size to cover the new links, so its next Trim leaves them.
+
+    Every policy counts the links its list allocated (Allocations()), the
+    allocator calls that got them (Blocks()) and the links freed on its
+    advice or by a compaction (Trimmed()), so a driver can weigh memory against allocation
+    rate; mlist2c.cpp reports all three. The counts belong to
+    the policy object, which a copy or Clone of the list copies and a move
+    takes along. A list is tuned by assigning it a new policy, which also
+    restarts the counts:
+
+      alt2c::List<T,fsu::NoIndex,std::allocator<T>,alt2c::FractionRetention> queue;
+      queue.Retention() = alt2c::FractionRetention(0.5,256);
+
+    alt2c::ArrayRing<T,R> (aring.h) takes the same policies and counts in
+    slots of its array instead of links; its array always doubles, so it
+    does not ask Grow.
+*/
+
+#ifndef _RETENTION_H
+#define _RETENTION_H
+
+#include <cstdlib>     // size_t
+
+namespace alt2c
+{
+
+  //----------------------------------
+  //     RetentionCounts
+  //----------------------------------
+
+  class RetentionCounts // base of the policies
+  {
+  public:
+    RetentionCounts () : allocations_(0), blocks_(0), trimmed_(0) {}
+
+    static size_t Grow (size_t size)  { return size / 2 + 1; } // links added to a full ring
+    void   Allocated   (size_t n = 1) { allocations_ += n; ++blocks_; }
+    void   Freed       (size_t n)     { trimmed_ += n; }
+    size_t Allocations () const       { return allocations_; } // links allocated, head and tail included
+    size_t Blocks      () const       { return blocks_; }      // allocator calls that got them
+    size_t Trimmed     () const       { return trimmed_; }     // links freed on the policy's advice or compacted
+
+  private:
+    size_t allocations_, blocks_, trimmed_;
+  } ;
+
+  //----------------------------------
+  //     KeepAll
+  //----------------------------------
+
+  class KeepAll : public RetentionCounts
+  {
+  public:
+    static size_t Trim (size_t , size_t ) { return 0; }
+  } ;
+
+  //----------------------------------
+  //     FractionRetention
+  //----------------------------------
+
+  class FractionRetention : public RetentionCounts
+  {
+  public:
+    explicit FractionRetention (double fraction = 1.0, size_t batch = 64)
+      : fraction_(fraction > 0 ? fraction : 0), batch_(batch) {}
+
+    size_t Trim (size_t size, size_t excess) const
+    {
+      double keep = fraction_ * size;
+      if (keep + batch_ > excess)
+        return 0;
+      return excess - static_cast<size_t>(keep);
+    }
+
+    size_t Grow (size_t size) const
+    {
+      size_t n = static_cast<size_t>(fraction_ * size);
+      return n ? n : 1;
+    }
+
+    double Fraction () const { return fraction_; }
+    size_t Batch    () const { return batch_; }
+
+  private:
+    double fraction_;  // unused links kept, per element
+    size_t batch_;     // excess over the limit that triggers a trim
+  } ;
+
+  //----------------------------------
+  //     DecayRetention
+  //----------------------------------
+
+  class DecayRetention : public RetentionCounts
+  {
+  public:
+    explicit DecayRetention (size_t period = 4096, size_t batch = 64)
+      : period_(period ? period : 1), batch_(batch), mark_(0), count_(0) {}
+
+    size_t Trim (size_t size, size_t excess)
+    {
+      if (mark_ < size + 1) // the size before this removal
+        mark_ = size + 1;
+      if (++count_ >= period_)
+      {
+        count_ = 0;
+        mark_ -= (mark_ - size) / 2;
+      }
+      size_t keep = mark_ - size;
+      if (keep + batch_ > excess)
+        return 0;
+      return excess - keep;
+    }
+
+    size_t Grow (size_t size)
+    {
+      size_t n = RetentionCounts::Grow(size);
+      if (mark_ < size + n)
+        mark_ = size + n;
+      return n;
+    }
+
+    size_t Period () const { return period_; }
+    size_t Batch  () const { return batch_; }
+    size_t Mark   () const { return mark_; }  // the remembered size
+
+  private:
+    size_t period_;    // removals between decays
+    size_t batch_;     // excess over the limit that triggers a trim
+    size_t mark_;      // largest recent size
+    size_t count_;     // removals since the last decay
+  } ;
+
+} // namespace alt2c
+
+#endif
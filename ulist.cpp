@@ -0,0 +1,1049 @@
+/*
+    ulist.cpp
+    Andrew J Wood
+
+    slave file to ulist.h
+
+    Implementation of the UnrolledList<T,N> API, except for the macro-mutators
+    (mutators of entire list), which are in ulist_macro.cpp
+*/
+
+//----------------------------------
+//     UnrolledList<T,N>:: Implementations
+//----------------------------------
+
+// stand-alone functions
+
+template < typename T , size_t N >
+bool operator == (const UnrolledList<T,N>& x1, const UnrolledList<T,N>& x2)
+// compares the lists run by run, a run being the part of a node of x1 and a
+// node of x2 that overlap in position
+{
+  if (x1.Size() != x2.Size())
+    return 0;
+  typename UnrolledList<T,N>::Node * n1 = x1.head_->next_, * n2 = x2.head_->next_;
+  size_t i1 = 0, i2 = 0;
+  while (n1 != x1.tail_) // equal sizes, so n2 reaches x2.tail_ at the same time
+  {
+    size_t run = n1->count_ - i1;
+    if (n2->count_ - i2 < run)
+      run = n2->count_ - i2;
+    const T * e1 = n1->Elements() + i1, * e2 = n2->Elements() + i2;
+    for (size_t k = 0; k < run; ++k)
+    {
+      if (e1[k] != e2[k])
+        return 0;
+    }
+    i1 += run;
+    i2 += run;
+    if (i1 == n1->count_) { n1 = n1->next_; i1 = 0; }
+    if (i2 == n2->count_) { n2 = n2->next_; i2 = 0; }
+  }
+  return 1;
+}
+
+template < typename T , size_t N >
+bool operator != (const UnrolledList<T,N>& x1, const UnrolledList<T,N>& x2)
+{
+  return !(x1 == x2);
+}
+
+template < typename T , size_t N >
+std::ostream& operator << (std::ostream& os, const UnrolledList<T,N>& x2)
+{
+  x2.Display(os);
+  return os;
+}
+
+// end stand-alone functions */
+
+// memory allocator and other private methods
+
+template < typename T , size_t N >
+typename UnrolledList<T,N>::Node * UnrolledList<T,N>::NewNode ()
+{
+  Node * newNode = nullptr;
+  if (pool_ == nullptr)
+  {
+    newNode = new(std::nothrow) Node;
+  }
+  else
+  {
+    void * storage = pool_->Allocate();
+    if (storage != nullptr)
+      newNode = new(storage) Node;
+  }
+  if (nullptr == newNode)
+  {
+    // exception handler
+    std::cerr << "** List error: memory allocation failure\n";
+    return nullptr;
+  }
+  return newNode;
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::DeleteNode (Node * oldNode)
+// return oldNode to wherever NewNode got it; its elements must already be destroyed
+{
+  if (pool_ == nullptr)
+  {
+    delete oldNode;
+  }
+  else
+  {
+    oldNode->~Node();
+    pool_->Deallocate(oldNode);
+  }
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::LinkIn (Node * location, Node * newNode)
+// link newNode into list at (ahead of) location
+{
+  newNode->next_ = location;
+  newNode->prev_ = location->prev_;
+  newNode->next_->prev_ = newNode;
+  newNode->prev_->next_ = newNode;
+}
+
+template < typename T , size_t N >
+typename UnrolledList<T,N>::Node * UnrolledList<T,N>::LinkOut (Node * oldNode)
+// unlink oldNode from list, return oldNode
+{
+  oldNode->prev_->next_ = oldNode->next_;
+  oldNode->next_->prev_ = oldNode->prev_;
+  oldNode->prev_ = nullptr;
+  oldNode->next_ = nullptr;
+  return oldNode;
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Init()
+// used by constructors; slot 0 of head_ and tail_ holds a default T [5]
+{
+  head_ = NewNode();
+  tail_ = NewNode();
+  new (head_->data_) T();
+  new (tail_->data_) T();
+  head_->next_ = tail_;
+  tail_->prev_ = head_;
+  size_ = 0;
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Append(const UnrolledList<T,N>& list)
+// Appends deep copy of rhs - do not apply to self!
+{
+  for (Node * n = list.head_->next_; n != list.tail_; n = n->next_)
+  {
+    T * e = n->Elements();
+    for (size_t k = 0; k < n->count_; ++k)
+      PushBack(e[k]);
+  }
+}
+
+template < typename T , size_t N >
+template < class... Args >
+UnrolledListIterator<T,N> UnrolledList<T,N>::InsertAt (Node * n, size_t k, Args&&... args)
+// construct a new element at position k of n and return its position
+// pre: n is tail_ and k == 0, or n is a node of the list and k < n->count_
+{
+  if (k == 0) // a node boundary: use the room at the back of the previous node
+  {
+    Node * p = n->prev_;
+    if (p != head_ && p->count_ < N)
+    {
+      new (p->data_ + p->count_) T(std::forward<Args>(args)...);
+      ++p->count_;
+      ++size_;
+      return Iterator(p, p->count_ - 1);
+    }
+    if (n == tail_ || n->count_ == N) // no room on either side: start a new node
+    {
+      Node * m = NewNode();
+      if (m == nullptr) return End();
+      LinkIn(n,m);
+      new (m->data_) T(std::forward<Args>(args)...);
+      m->count_ = 1;
+      ++size_;
+      return Iterator(m,0);
+    }
+  }
+  // the new element goes inside n; build it first, since args may refer to
+  // an element of n that is about to move
+  T value(std::forward<Args>(args)...);
+  if (n->count_ == N) // split a full node, moving its back half to a new node
+  {
+    Node * m = NewNode();
+    if (m == nullptr) return End();
+    LinkIn(n->next_,m);
+    T * e = n->Elements();
+    for (size_t j = N/2; j < N; ++j)
+    {
+      new (m->data_ + (j - N/2)) T(std::move(e[j]));
+      e[j].~T();
+    }
+    m->count_ = N - N/2;
+    n->count_ = N/2;
+    if (k > n->count_)
+    {
+      k -= n->count_;
+      n = m;
+    }
+  }
+  T * e = n->Elements();
+  size_t c = n->count_;
+  if (k == c)
+  {
+    new (n->data_ + c) T(std::move(value));
+  }
+  else // shift [k,c) up one place
+  {
+    new (n->data_ + c) T(std::move(e[c-1]));
+    for (size_t j = c - 1; j > k; --j)
+      e[j] = std::move(e[j-1]);
+    e[k] = std::move(value);
+  }
+  ++n->count_;
+  ++size_;
+  return Iterator(n,k);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Erase (Node * n, size_t k)
+// remove the element at position k of n and return the position following it;
+// a node left empty is deleted
+{
+  T * e = n->Elements();
+  for (size_t j = k; j + 1 < n->count_; ++j)
+    e[j] = std::move(e[j+1]);
+  e[n->count_ - 1].~T();
+  --n->count_;
+  --size_;
+  if (n->count_ == 0)
+  {
+    Node * next = n->next_;
+    DeleteNode(LinkOut(n));
+    return Iterator(next,0);
+  }
+  if (k == n->count_)
+    return Iterator(n->next_,0);
+  return Iterator(n,k);
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Coalesce (Node * n)
+// move the elements of n->next_ to the back of n when together they fill
+// at most half a node, and delete the emptied node
+{
+  if (n == head_ || n == tail_)
+    return;
+  Node * m = n->next_;
+  if (m == tail_ || n->count_ + m->count_ > N/2)
+    return;
+  T * e = m->Elements();
+  for (size_t j = 0; j < m->count_; ++j)
+  {
+    new (n->data_ + n->count_ + j) T(std::move(e[j]));
+    e[j].~T();
+  }
+  n->count_ += m->count_;
+  DeleteNode(LinkOut(m));
+}
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::Split (Iterator& i, Iterator& a, Iterator& b)
+// make i the first position of its node by moving the elements from i on to a
+// new node; a and b are kept at the same elements
+{
+  if (i.index_ == 0)
+    return 1;
+  Node * n = i.node_;
+  size_t k = i.index_;
+  Node * m = NewNode();
+  if (m == nullptr) return 0;
+  LinkIn(n->next_,m);
+  T * e = n->Elements();
+  for (size_t j = k; j < n->count_; ++j)
+  {
+    new (m->data_ + (j - k)) T(std::move(e[j]));
+    e[j].~T();
+  }
+  m->count_ = n->count_ - k;
+  n->count_ = k;
+  if (a.node_ == n && a.index_ >= k) { a.node_ = m; a.index_ -= k; }
+  if (b.node_ == n && b.index_ >= k) { b.node_ = m; b.index_ -= k; }
+  i.node_ = m;
+  i.index_ = 0;
+  return 1;
+}
+
+// end private methods */
+
+// constructors and assignment
+
+template < typename T , size_t N >
+UnrolledList<T,N>::UnrolledList ()  :  head_(nullptr), tail_(nullptr), size_(0), pool_(nullptr)
+// default constructor
+{
+  Init();
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>::UnrolledList (Pool& pool)  :  head_(nullptr), tail_(nullptr), size_(0), pool_(&pool)
+// nodes come from (and go back to) pool
+{
+  Init();
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>::UnrolledList (Pool* pool)  :  head_(nullptr), tail_(nullptr), size_(0), pool_(pool)
+// protected: pool may be nullptr
+{
+  Init();
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>::UnrolledList (const UnrolledList<T,N>& x) : head_(nullptr), tail_(nullptr), size_(0), pool_(x.pool_)
+// copy constructor - the copy shares the pool of x
+{
+  Init();
+  Append(x);
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>::UnrolledList (UnrolledList<T,N>&& x) : head_(x.head_), tail_(x.tail_), size_(x.size_), pool_(x.pool_)
+// move constructor - takes the nodes of x and leaves x empty
+{
+  x.Init();
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>::~UnrolledList ()
+// destructor
+{
+  Release();
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>& UnrolledList<T,N>::operator = (const UnrolledList<T,N>& rhs)
+// assignment operator - existing elements are overwritten in place, so only
+// the difference in length is constructed or destroyed
+{
+  if (this != &rhs)
+  {
+    Node * n = head_->next_;
+    size_t k = 0;
+    for (Node * m = rhs.head_->next_; m != rhs.tail_; m = m->next_)
+    {
+      T * e = m->Elements();
+      for (size_t j = 0; j < m->count_; ++j)
+      {
+        if (n == tail_)
+        {
+          PushBack(e[j]);
+          continue;
+        }
+        n->Elements()[k] = e[j];
+        if (++k == n->count_)
+        {
+          n = n->next_;
+          k = 0;
+        }
+      }
+    }
+    // drop the surplus from position k of n on
+    while (n != tail_)
+    {
+      T * e = n->Elements();
+      for (size_t j = k; j < n->count_; ++j)
+        e[j].~T();
+      size_ -= n->count_ - k;
+      n->count_ = k;
+      n = n->next_;
+      if (k == 0)
+        DeleteNode(LinkOut(n->prev_));
+      k = 0;
+    }
+  }
+  return *this;
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>& UnrolledList<T,N>::operator = (UnrolledList<T,N>&& rhs)
+// move assignment - exchanges nodes with rhs, which takes the old elements
+{
+  std::swap(head_,rhs.head_);
+  std::swap(tail_,rhs.tail_);
+  std::swap(size_,rhs.size_);
+  std::swap(pool_,rhs.pool_);
+  return *this;
+}
+
+template < typename T , size_t N >
+UnrolledList<T,N>& UnrolledList<T,N>::operator += (const UnrolledList<T,N>& list)
+// append operator
+{
+  if (this != &list)
+    Append(list);
+  return *this;
+}
+
+// inserting mutators
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PushFront (const T& t)
+{
+  return EmplaceFront(t);
+}
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PushBack (const T& t)
+{
+  return EmplaceBack(t);
+}
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PushFront (T&& t)
+{
+  return EmplaceFront(std::move(t));
+}
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PushBack (T&& t)
+{
+  return EmplaceBack(std::move(t));
+}
+
+template < typename T , size_t N >
+template < class... Args >
+bool UnrolledList<T,N>::EmplaceFront (Args&&... args)
+{
+  return InsertAt(head_->next_, 0, std::forward<Args>(args)...).node_ != tail_;
+}
+
+template < typename T , size_t N >
+template < class... Args >
+bool UnrolledList<T,N>::EmplaceBack (Args&&... args)
+{
+  return InsertAt(tail_, 0, std::forward<Args>(args)...).node_ != tail_;
+}
+
+template < typename T , size_t N >
+template < class... Args >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Emplace (Iterator i, Args&&... args)
+// construct T(args...) at (in front of) i; return iterator at new element
+{
+  if (Empty())  // always insert
+  {
+    i = End();
+  }
+  if (!i.Valid() || i == rEnd()) // null or off-the-front
+  {
+    std::cerr << " ** cannot insert at position -1\n";
+    return End();
+  }
+  return InsertAt(i.node_, i.index_, std::forward<Args>(args)...);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Insert (Iterator i, const T& t)
+// Insert t at (in front of) i; return i at new element
+{
+  return Emplace(i,t);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Insert (Iterator i, T&& t)
+{
+  return Emplace(i,std::move(t));
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N> UnrolledList<T,N>::Insert (ConstIterator i, const T& t)
+// Insert t at (in front of) i; return i at new element
+{
+  return Emplace(Iterator(i.node_,i.index_),t);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Insert (const T& t)
+// Insert t at default location (back)
+{
+  return InsertAt(tail_, 0, t);
+}
+
+// removing mutators
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PopFront()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopFront() called on empty list\n";
+    return 0;
+  }
+  Remove(Begin());
+  return 1;
+} // end PopFront()
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::PopBack()
+{
+  if (Empty())
+  {
+    std::cerr << "** List error: PopBack() called on empty list\n";
+    return 0;
+  }
+  Remove(rBegin());
+  return 1;
+} // end PopBack()
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Remove (Iterator i)
+// Remove item at i; return i at the following element
+{
+  // first deal with the impossible cases
+  if (i.node_ == nullptr || i.node_ == head_ || i.node_ == tail_)
+  {
+    std::cerr << "** List error: Remove(i) called with vacuous iterator\n";
+    return i;
+  }
+  Node * n = i.node_;
+  if (n->count_ == 1)            // n goes away with its element
+    return Erase(n,i.index_);
+  i = Erase(n,i.index_);
+  if (i.node_ != n)              // removed the back of n
+  {
+    i.node_ = n;
+    i.index_ = n->count_;
+  }
+  Coalesce(n);                   // join a sparse n with its successor
+  if (i.index_ == n->count_)
+  {
+    i.node_ = n->next_;
+    i.index_ = 0;
+  }
+  return i;
+} // end Remove(Iterator)
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N> UnrolledList<T,N>::Remove (ConstIterator i)
+// Remove item at i
+{
+  return Remove(Iterator(i.node_,i.index_));
+} // end Remove(ConstIterator)
+
+template < typename T , size_t N >
+size_t UnrolledList<T,N>::Remove (const T& t)
+// Remove all copies of t: each node is compacted in one pass, and joined with
+// the node kept before it when together they fill at most half a node, as
+// Remove(i) does
+{
+  const T value(t); // t may be an element of this list
+  size_t count(0);
+  Node * n = head_->next_, * last = head_; // last = the node kept before n
+  while (n != tail_)
+  {
+    T * e = n->Elements();
+    size_t kept = 0;
+    for (size_t k = 0; k < n->count_; ++k)
+    {
+      if (value == e[k])
+        continue;
+      if (kept != k)
+        e[kept] = std::move(e[k]);
+      ++kept;
+    }
+    for (size_t k = kept; k < n->count_; ++k)
+      e[k].~T();
+    count += n->count_ - kept;
+    n->count_ = kept;
+    Node * next = n->next_;
+    if (kept == 0)
+      DeleteNode(LinkOut(n));
+    else if (last != head_ && last->count_ + kept <= N/2)
+      Coalesce(last);  // n joins last
+    else
+      last = n;
+    n = next;
+  }
+  size_ -= count;
+  return count;
+}  // end Remove(t)
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Clear()
+// Makes list empty
+{
+  while (head_->next_ != tail_)
+  {
+    Node * n = LinkOut(head_->next_);
+    T * e = n->Elements();
+    for (size_t k = 0; k < n->count_; ++k)
+      e[k].~T();
+    DeleteNode(n);
+  }
+  size_ = 0;
+} // end Clear()
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Release()
+// Deletes all nodes
+{
+  Clear();
+  head_->Elements()->~T();
+  tail_->Elements()->~T();
+  DeleteNode(head_);
+  DeleteNode(tail_);
+} // end Release()
+
+template < typename T , size_t N >
+UnrolledList<T,N> * UnrolledList<T,N>::Clone() const
+// returns pointer to a copy of *this
+{
+  UnrolledList * clone = new UnrolledList(pool_);
+  clone->Append(*this);
+  return clone;
+}
+
+// accessors
+
+template < typename T , size_t N >
+size_t UnrolledList<T,N>::Size()  const
+{
+  return size_;
+}
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::Empty()  const
+{
+  return (head_->next_ == tail_);
+}
+
+template < typename T , size_t N >
+ListStats UnrolledList<T,N>::Stats() const
+{
+  ListStats s;
+  s.elements  = size_;
+  s.sentinels = 2;
+  for (Node * n = head_->next_; n != tail_; n = n->next_)
+  {
+    ++s.links;
+    if (PayloadBytes<T>::deep)
+      for (size_t k = 0; k < n->count_; ++k)
+        s.payloadBytes += PayloadBytes<T>::Bytes(n->Elements()[k]);
+  }
+  s.linkBytes   = (s.links + s.sentinels) * sizeof(Node);
+  s.objectBytes = sizeof(*this);
+  return s;
+}
+
+template < typename T , size_t N >
+size_t UnrolledList<T,N>::MemoryUsage() const
+{
+  return Stats().Bytes();
+}
+
+template < typename T , size_t N >
+T& UnrolledList<T,N>::Front ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T , size_t N >
+const T& UnrolledList<T,N>::Front () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Front() called on empty list\n";
+  }
+  return *Begin();
+}
+
+template < typename T , size_t N >
+T& UnrolledList<T,N>::Back  ()
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+template < typename T , size_t N >
+const T& UnrolledList<T,N>::Back  () const
+{
+  if (Empty())
+  {
+      std::cerr << "** List error: Back() called on empty list\n";
+  }
+  return *rBegin();
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledList<T,N>::Includes (const T& t)
+// sequential search, node by node
+{
+  for (Node * n = head_->next_; n != tail_; n = n->next_)
+  {
+    T * e = n->Elements();
+    for (size_t k = 0; k < n->count_; ++k)
+    {
+      if (t == e[k])
+        return Iterator(n,k);
+    }
+  }
+  return End();
+} // Includes()
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N> UnrolledList<T,N>::Includes (const T& t) const
+{
+  for (Node * n = head_->next_; n != tail_; n = n->next_)
+  {
+    T * e = n->Elements();
+    for (size_t k = 0; k < n->count_; ++k)
+    {
+      if (t == e[k])
+        return ConstIterator(n,k);
+    }
+  }
+  return End();
+} // Includes()
+
+// output methods
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Display (std::ostream& os, char ofc) const
+{
+  for (Node * n = head_->next_; n != tail_; n = n->next_)
+  {
+    T * e = n->Elements();
+    if (ofc == '\0')
+      for (size_t k = 0; k < n->count_; ++k)
+        os << e[k];
+    else
+      for (size_t k = 0; k < n->count_; ++k)
+        os << ofc << e[k];
+  }
+} // Display()
+
+// debug/developer methods
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Dump (std::ostream& os, char ofc) const
+{
+  Display(os,ofc);
+  os << '\n';
+} // Dump()
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::CheckLinks(std::ostream& os) const
+{
+  // node structure: links, fill and element count
+  size_t n = 0, count = 0;
+  Node * node;
+  for (node = head_; node != tail_; node = node->next_, ++n)
+  {
+    if (node->next_ == nullptr || node->next_->prev_ != node)
+    {
+      os << " ** node link failure at node " << n << '\n';
+      return;
+    }
+    if (node != head_ && (node->count_ == 0 || node->count_ > N))
+    {
+      os << " ** node count failure at node " << n << ": count = " << node->count_ << '\n';
+    }
+    count += node->count_;
+  }
+  if (count != Size())
+  {
+    os << " ** Size() mismatch: count = " << count << " , size = " << Size() << '\n';
+  }
+
+  // iterator reciprocity
+  typename UnrolledList<T,N>::ConstIterator i,j,k;
+  for (i = this->Begin(), n = 0; i != this->End(); ++i, ++n)
+  {
+    j = i; --j; ++j;
+    k = i; ++k; --k;
+    if (!i.Valid() || !j.Valid() || !k.Valid() || i != j || i != k)
+    {
+      os << " ** forward reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+  for (i = this->rBegin(), n = Size(); i != this->rEnd(); --i, --n)
+  {
+    j = i; --j; ++j;
+    k = i; ++k; --k;
+    if (!i.Valid() || !j.Valid() || !k.Valid() || i != j || i != k)
+    {
+      os << " ** reverse reciprocity failure at position " << n << '\n';
+      break;
+    }
+  }
+} // CheckLinks()
+
+// Iterator support
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>  UnrolledList<T,N>::Begin()
+{
+  return Iterator(head_->next_,0);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>  UnrolledList<T,N>::End()
+{
+  return Iterator(tail_,0);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>  UnrolledList<T,N>::rBegin()
+{
+  Node * n = tail_->prev_;
+  return Iterator(n, n->count_ == 0 ? 0 : n->count_ - 1);
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>  UnrolledList<T,N>::rEnd ()
+{
+  return Iterator(head_,0);
+}
+
+// ConstIterator support
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>  UnrolledList<T,N>::Begin() const
+{
+  return ConstIterator(head_->next_,0);
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>  UnrolledList<T,N>::End() const
+{
+  return ConstIterator(tail_,0);
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>  UnrolledList<T,N>::rBegin() const
+{
+  Node * n = tail_->prev_;
+  return ConstIterator(n, n->count_ == 0 ? 0 : n->count_ - 1);
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>  UnrolledList<T,N>::rEnd () const
+{
+  return ConstIterator(head_,0);
+}
+
+//-------------------------------------------
+//     ConstUnrolledListIterator<T,N>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>::ConstUnrolledListIterator ()  :  node_(nullptr), index_(0)
+// construct a null iterator
+{}
+
+// protected constructor
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>::ConstUnrolledListIterator (typename UnrolledList<T,N>::Node * node, size_t index)
+   :  node_(node), index_(index)
+// construct an iterator at a node position (not available to client programs)
+{}
+
+// copy constructor
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>::ConstUnrolledListIterator (const ConstUnrolledListIterator<T,N>& i)
+   :  node_(i.node_), index_(i.index_)
+{}
+
+// assignment operator
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>& ConstUnrolledListIterator<T,N>::operator = (const ConstUnrolledListIterator<T,N>& i)
+{
+  node_ = i.node_;
+  index_ = i.index_;
+  return *this;
+}
+
+// protected method
+template < typename T , size_t N >
+T&  ConstUnrolledListIterator<T,N>::Retrieve() const
+// Return reference to current t
+// note conflicted signature - const method returns non-const reference
+{
+  if (node_ == nullptr)
+  {
+    std::cerr << "** Error: ConstUnrolledListIterator<T,N>::Retrieve() invalid dereference\n";
+    exit (EXIT_FAILURE);
+  }
+  return node_->Elements()[index_];
+}
+
+template < typename T , size_t N >
+bool ConstUnrolledListIterator<T,N>::Valid() const
+// test cursor for legal dereference
+{
+  return node_ != nullptr;
+}
+
+template < typename T , size_t N >
+bool ConstUnrolledListIterator<T,N>::operator == (const ConstUnrolledListIterator<T,N>& i2) const
+{
+  return node_ == i2.node_ && index_ == i2.index_;
+}
+
+template < typename T , size_t N >
+bool ConstUnrolledListIterator<T,N>::operator != (const ConstUnrolledListIterator<T,N>& i2) const
+{
+  return !(*this == i2);
+}
+
+template < typename T , size_t N >
+const T&  ConstUnrolledListIterator<T,N>::operator * () const
+{
+  return Retrieve();
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>& ConstUnrolledListIterator<T,N>::operator ++ ()
+// prefix increment: next slot of the node, else first slot of the next node
+{
+  if (node_ != nullptr && ++index_ >= node_->count_)
+  {
+    node_ = node_->next_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N> ConstUnrolledListIterator<T,N>::operator ++ (int)
+// postfix increment
+{
+   ConstUnrolledListIterator <T,N> clone = *this;
+   this->operator++();
+   return clone;
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N>& ConstUnrolledListIterator<T,N>::operator -- ()
+// prefix decrement: previous slot of the node, else last slot of the previous node
+{
+  if (node_ == nullptr)
+    return *this;
+  if (index_ > 0)
+  {
+    --index_;
+  }
+  else
+  {
+    node_ = node_->prev_;
+    if (node_ != nullptr && node_->count_ > 0)
+      index_ = node_->count_ - 1;
+  }
+  return *this;
+}
+
+template < typename T , size_t N >
+ConstUnrolledListIterator<T,N> ConstUnrolledListIterator<T,N>::operator -- (int)
+// postfix decrement
+{
+   ConstUnrolledListIterator <T,N> clone = *this;
+   this->operator--();
+   return clone;
+}
+
+//-------------------------------------------
+//     UnrolledListIterator<T,N>:: Implementations
+//-------------------------------------------
+
+// default constructor
+template < typename T , size_t N >
+UnrolledListIterator<T,N>::UnrolledListIterator ()  :  ConstUnrolledListIterator<T,N>()
+// construct a null iterator
+{}
+
+// initializing constructor
+template < typename T , size_t N >
+UnrolledListIterator<T,N>::UnrolledListIterator (UnrolledList<T,N>& x)  :  ConstUnrolledListIterator<T,N>(x.Begin())
+// construct an iterator at the front of x
+{}
+
+// protected constructor
+template < typename T , size_t N >
+UnrolledListIterator<T,N>::UnrolledListIterator (typename UnrolledList<T,N>::Node * node, size_t index)
+   :  ConstUnrolledListIterator<T,N>(node,index)
+// construct an iterator at a node position (not available to client programs)
+{}
+
+// copy constructor
+template < typename T , size_t N >
+UnrolledListIterator<T,N>::UnrolledListIterator (const UnrolledListIterator<T,N>& i)
+   :  ConstUnrolledListIterator<T,N>(i)
+{}
+
+// assignment operator
+template < typename T , size_t N >
+UnrolledListIterator<T,N>& UnrolledListIterator<T,N>::operator = (const UnrolledListIterator<T,N>& i)
+{
+  ConstUnrolledListIterator<T,N>::operator=(i);
+  return *this;
+}
+
+template < typename T , size_t N >
+const T&  UnrolledListIterator<T,N>::operator * () const
+{
+  return ConstUnrolledListIterator<T,N>::Retrieve();
+}
+
+template < typename T , size_t N >
+T&  UnrolledListIterator<T,N>::operator * ()
+{
+  return ConstUnrolledListIterator<T,N>::Retrieve();
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>& UnrolledListIterator<T,N>::operator ++ ()
+// prefix increment
+{
+  ConstUnrolledListIterator<T,N>::operator++();
+  return *this;
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledListIterator<T,N>::operator ++ (int)
+// postfix increment
+{
+   UnrolledListIterator <T,N> clone = *this;
+   this->operator++();
+   return clone;
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N>& UnrolledListIterator<T,N>::operator -- ()
+// prefix decrement
+{
+  ConstUnrolledListIterator<T,N>::operator--();
+  return *this;
+}
+
+template < typename T , size_t N >
+UnrolledListIterator<T,N> UnrolledListIterator<T,N>::operator -- (int)
+// postfix decrement
+{
+   UnrolledListIterator <T,N> clone = *this;
+   this->operator--();
+   return clone;
+}
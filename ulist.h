@@ -0,0 +1,366 @@
+/*
+    ulist.h
+    Andrew J Wood
+
+    Definition of the fsu::UnrolledList<T,N> API
+
+    An unrolled linked list: each node holds a fixed-capacity array of up to N
+    elements, so the per-element cost of the two link pointers is divided by
+    the fill of the node, and traversals run over contiguous storage. The
+    public interface is that of fsu::List<T> (list.h), so a client can switch
+    between the two with a single typedef:
+
+      typedef fsu::List < ElementType >          ContainerType;
+      typedef fsu::UnrolledList < ElementType >  ContainerType;
+
+    The node capacity N is a template parameter; its default is the macro
+    ULIST_BLOCK_SIZE, which may be set on the compiler command line. [1]
+*/
+
+#ifndef _ULIST_H
+#define _ULIST_H
+
+#include <iostream>    // class ostream and objects cerr, cout
+#include <cstdlib>     // EXIT_FAILURE, size_t
+#include <new>         // placement new, std::nothrow
+#include <type_traits> // std::aligned_storage
+#include <utility>     // std::move, std::forward, std::swap
+#include <compare.h>   // needed for Sort()
+#include <linkpool.h>  // optional shared node allocator
+#include <liststats.h> // ListStats, PayloadBytes
+
+#ifndef ULIST_BLOCK_SIZE
+#define ULIST_BLOCK_SIZE 16  // default number of elements per node [1]
+#endif
+
+namespace fsu
+{
+
+  template < typename T , size_t N = ULIST_BLOCK_SIZE >
+  class UnrolledList;
+
+  template < typename T , size_t N = ULIST_BLOCK_SIZE >
+  class ConstUnrolledListIterator;
+
+  template < typename T , size_t N = ULIST_BLOCK_SIZE >
+  class UnrolledListIterator;
+
+  //----------------------------------
+  //     UnrolledList<T,N>
+  //----------------------------------
+
+  template < typename T , size_t N >
+  class UnrolledList
+  {
+    static_assert(N >= 2, "UnrolledList: a node must hold at least two elements");
+
+  protected:
+    class Node; // defined below
+
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef UnrolledListIterator < T , N >         Iterator;
+    typedef ConstUnrolledListIterator < T , N >    ConstIterator;
+    typedef LinkPool < Node >                      Pool;  // [2]
+
+    // constructors and assignment
+                   UnrolledList       ();                      // default constructor
+    explicit       UnrolledList       (Pool& pool);            // nodes allocated from a shared pool [2]
+    virtual        ~UnrolledList      ();                      // destructor
+                   UnrolledList       (const UnrolledList& );  // copy constructor
+                   UnrolledList       (UnrolledList&& );       // move constructor
+    UnrolledList&  operator =         (const UnrolledList& );  // assignment
+    UnrolledList&  operator =         (UnrolledList&& );       // move assignment
+    virtual UnrolledList * Clone      () const;                // returns ptr to deep copy of this list
+
+    // modifying List structure - mutators [3]
+    bool      PushFront  (const T& t);   // Insert t at front of list
+    bool      PushBack   (const T& t);   // Insert t at back of list
+    Iterator  Insert     (Iterator i, const T& t);  // Insert t at i
+    ConstIterator  Insert     (ConstIterator i, const T& t);  // ConstIterator version
+    Iterator  Insert     (const T& t);   // Insert t at back
+    UnrolledList& operator+= (const UnrolledList& list); // append list
+
+    // move and in-place versions of the inserting mutators
+    bool      PushFront  (T&& t);
+    bool      PushBack   (T&& t);
+    Iterator  Insert     (Iterator i, T&& t);
+    template < class... Args >
+    bool      EmplaceFront (Args&&... args);  // construct T(args...) at front
+    template < class... Args >
+    bool      EmplaceBack  (Args&&... args);  // construct T(args...) at back
+    template < class... Args >
+    Iterator  Emplace      (Iterator i, Args&&... args); // construct T(args...) at i
+
+    bool      PopFront  ();              // Remove the Tval at front
+    bool      PopBack   ();              // Remove the Tval at back
+    Iterator  Remove    (Iterator i);    // Remove item at i
+    ConstIterator  Remove    (ConstIterator i);    // ConstIterator version
+    size_t    Remove    (const T& t);    // Remove all copies of t
+    void      Clear     ();              // Make the list empty
+    void      Release   ();              // Release all allocated memory
+
+    // macroscopic (whole list) mutators
+    void      Sort      ();               // default order <
+    void      Merge     (UnrolledList& list);  // merges "list" into this list
+    void      Reverse   ();
+    void      Shuffle   ();
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Sort      (Predicate& p);
+
+    template < class Predicate > // Predicate object used to determine order
+    void      Merge     (UnrolledList& list, Predicate& p);
+
+    // moving elements between lists [4]
+    void      Splice    (Iterator pos, UnrolledList& list);             // all of list, ahead of pos
+    void      Splice    (Iterator pos, UnrolledList& list, Iterator i); // element i of list
+    void      Splice    (Iterator pos, UnrolledList& list, Iterator first, Iterator last); // [first,last)
+
+    // information about the list - accessors
+    size_t    Size  () const;  // return the number of elements on the list
+    bool      Empty () const;  // true iff list has no elements
+
+    // memory held by the list; links are nodes [7]
+    ListStats Stats       () const;  // nodes, sentinels and bytes by kind
+    size_t    MemoryUsage () const;  // Stats().Bytes()
+
+    // accessing values on the list - more accessors
+    T&        Front ();        // return reference to Tval at front of list
+    const T&  Front () const;  // const version
+    T&        Back  ();        // return reference to Tval at back of list
+    const T&  Back  () const;  // const version
+
+    // Iterator support - locating places on the list
+    Iterator  Begin      (); // return iterator to front
+    Iterator  End        (); // return iterator "1 past the back"
+    Iterator  rBegin     (); // return iterator to back
+    Iterator  rEnd       (); // return iterator "1 past the front" in reverse
+    Iterator  Includes   (const T& t); // returns position of first occurrence of t, or End()
+
+    // ConstIterator support
+    ConstIterator  Begin      () const;
+    ConstIterator  End        () const;
+    ConstIterator  rBegin     () const;
+    ConstIterator  rEnd       () const;
+    ConstIterator  Includes   (const T& t) const;
+
+    // generic display methods
+    void Display (std::ostream& os, char ofc = '\0') const;
+    void Dump    (std::ostream& os, char ofc = '\0') const;
+
+    // structural integrity check
+    void CheckLinks(std::ostream& os = std::cout) const;
+
+  protected:
+    // a node holds count_ elements in the first count_ slots of data_ [5]
+    class Node
+    {
+      friend class UnrolledList<T,N>;
+      friend class ConstUnrolledListIterator<T,N>;
+      friend class UnrolledListIterator<T,N>;
+      template < typename U , size_t M >
+      friend bool operator == (const UnrolledList<U,M>& x1, const UnrolledList<U,M>& x2);
+
+      // Node variables
+      typename std::aligned_storage < sizeof(T), alignof(T) >::type data_[N];
+      size_t  count_;       // number of elements in data_
+      Node *  prev_;        // ptr to predecessor Node
+      Node *  next_;        // ptr to successor Node
+
+      Node () : count_(0), prev_(nullptr), next_(nullptr) {}
+      T* Elements () { return reinterpret_cast < T* > (data_); }
+    } ;
+
+    Node *  head_,  // node representing "one before the first"
+         *  tail_;  // node representing "one past the last"
+    size_t  size_;  // number of elements on the list
+    Pool *  pool_;  // node allocator; nullptr means operator new/delete
+
+    // protected methods -- used only by other methods
+    explicit UnrolledList (Pool* pool);  // list sharing the allocator of another
+    void Init   ();                      // sets up head and tail nodes
+    void Append (const UnrolledList& list); // append deep copy of list
+
+    // protected methods isolate memory allocation and associated error handling
+    Node * NewNode    ();
+    void   DeleteNode (Node * oldNode);
+
+    // element-level operations on one node; both may invalidate iterators into n
+    template < class... Args >
+    Iterator  InsertAt (Node * n, size_t k, Args&&... args); // construct at position k of n
+    Iterator  Erase    (Node * n, size_t k);                 // remove position k of n
+    void      Coalesce (Node * n);                // absorb n->next_ if the two fit in one node
+    bool      Split    (Iterator& i, Iterator& a, Iterator& b); // make i the start of a node
+
+    // merging runs of nodes for Sort and Merge [6]
+    template < class P >
+    static void   SortNode  (Node * n, P& comp);
+    template < class P >
+    static Node * MergeRuns (Node * a, Node * b, P& comp, Node *& spare);
+    bool          Reserve   (Node *& spare, size_t count); // chain count spare nodes
+    void          Recycle   (Node * spare);                 // free a spare chain
+    void          Attach    (Node * chain); // hang a null-terminated chain between head_ and tail_
+
+    // standard link-in and link-out processes
+    static void   LinkIn  (Node * location, Node * newNode);
+    static Node * LinkOut (Node * oldNode);
+
+    // tight couplings
+    friend class UnrolledListIterator<T,N>;
+    friend class ConstUnrolledListIterator<T,N>;
+    template < typename U , size_t M >
+    friend bool operator == (const UnrolledList<U,M>& x1, const UnrolledList<U,M>& x2);
+  } ;
+
+  // global scope operators and functions
+
+  template < typename T , size_t N >
+  bool operator == (const UnrolledList<T,N>& list1, const UnrolledList<T,N>& list2);
+
+  template < typename T , size_t N >
+  bool operator != (const UnrolledList<T,N>& list1, const UnrolledList<T,N>& list2);
+
+  template < typename T , size_t N >
+  std::ostream& operator << (std::ostream& os, const UnrolledList<T,N>& list);
+
+  //----------------------------------
+  //     ConstUnrolledListIterator<T,N>
+  //----------------------------------
+
+  template < typename T , size_t N >
+  class ConstUnrolledListIterator
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstUnrolledListIterator < T , N >    ConstIterator;
+    typedef UnrolledListIterator < T , N >         Iterator;
+
+    // constructors
+    ConstUnrolledListIterator       ();                                  // default constructor
+    ConstUnrolledListIterator       (const ConstUnrolledListIterator& ); // copy constructor
+
+    // information/access
+    bool Valid         () const;  // cursor is valid element
+
+    // various operators
+    bool            operator == (const ConstIterator& i2) const;
+    bool            operator != (const ConstIterator& i2) const;
+    const T&        operator *  () const; // Return const reference to current Tval
+    ConstIterator&  operator =  (const ConstIterator& i);
+    ConstIterator&  operator ++ ();    // prefix
+    ConstIterator   operator ++ (int); // postfix
+    ConstIterator&  operator -- ();    // prefix
+    ConstIterator   operator -- (int); // postfix
+
+  protected:
+    // data: position index_ in node node_
+    typename UnrolledList<T,N>::Node * node_;
+    size_t                             index_;
+
+    // methods
+    ConstUnrolledListIterator (typename UnrolledList<T,N>::Node * node, size_t index); // type converting constructor
+    T& Retrieve () const; // conflicted Retrieve used by both versions of operator*
+
+    // tight couplings
+    friend class UnrolledList<T,N>;
+  } ;
+
+  //----------------------------------
+  //     UnrolledListIterator<T,N>
+  //----------------------------------
+
+  template < typename T , size_t N >
+  class UnrolledListIterator : public ConstUnrolledListIterator<T,N>
+  {
+  public:
+    // terminology support
+    typedef T                                      ValueType;
+    typedef ConstUnrolledListIterator < T , N >    ConstIterator;
+    typedef UnrolledListIterator < T , N >         Iterator;
+
+    // constructors
+    UnrolledListIterator       ();                               // default constructor
+    UnrolledListIterator       (UnrolledList<T,N>& );            // initializing constructor
+    UnrolledListIterator       (const UnrolledListIterator& );   // copy constructor
+
+    // various operators
+    T&         operator *  ();       // Return reference to current Tval
+    const T&   operator *  () const; // const version
+    Iterator&  operator =  (const Iterator& i);
+    Iterator&  operator ++ ();    // prefix
+    Iterator   operator ++ (int); // postfix
+    Iterator&  operator -- ();    // prefix
+    Iterator   operator -- (int); // postfix
+
+  protected:
+    // methods
+    UnrolledListIterator (typename UnrolledList<T,N>::Node * node, size_t index); // type converting constructor
+
+    // tight couplings
+    friend class UnrolledList<T,N>;
+  } ;
+
+#include <ulist.cpp>
+#include <ulist_macro.cpp>
+
+} // namespace fsu
+
+/* Notes
+   =====
+
+[1] A node costs N * sizeof(T) bytes of element storage plus a count and two
+    pointers, so for small T a larger N amortizes the overhead better, while
+    Insert and Remove shift up to N elements inside a node. For example
+
+      g++ -DULIST_BLOCK_SIZE=64 ...        // change the default for all lists
+      fsu::UnrolledList < char, 64 > x;    // or choose per list type
+
+[2] As for fsu::List, a list constructed with a Pool takes its nodes from the
+    pool, and copies and Clone() share the pool of the original. Merge and
+    Splice relink nodes directly when both lists use the same pool; otherwise
+    the elements are moved into nodes from this list's pool.
+
+[3] Positions are (node, index) pairs, and elements are shifted within a node
+    by Insert and Remove and moved between nodes when a full node is split or
+    two sparse nodes are joined. Therefore, unlike fsu::List, mutators may make
+    iterators to other elements of the same list illegitimate:
+
+      Insert, Emplace, Push, Pop, Remove(i) - iterators into the affected nodes
+      Remove(t), Sort, Merge, Shuffle       - all iterators of the list
+      Reverse                               - all iterators of the list; each
+                                              stays at its slot, whose element
+                                              is now another one
+      Splice                                - all iterators of both lists
+
+    Front, Back, Includes and the accessors leave iterators alone.
+    The returned iterator of Insert and Remove(i) is always legitimate.
+
+[4] Splice moves elements without copying them. Whole chains of nodes are
+    relinked; at most three nodes are split so that the range boundaries and
+    pos fall on node boundaries, and the seams are joined afterwards where
+    the nodes are sparse. x may be this list for the single element and range
+    versions, in which case pos must not lie inside the range.
+
+[5] A node on the list always holds at least one element, and its elements
+    occupy data_[0 .. count_-1]. The head and tail nodes hold no elements;
+    slot 0 of each holds a default T so that, as with fsu::List, *End() and
+    *rEnd() are defined. Empty nodes are returned to the allocator at once.
+
+[6] Sort sorts each node in place (insertion sort) and then merges runs of
+    nodes bottom-up, refilling nodes to capacity as it goes; Merge does one
+    such merge. Both are stable. The nodes emptied by a merge are reused for
+    its output, so a merge needs at most two nodes beyond those it consumes;
+    these are reserved before any element moves, so an allocation failure
+    leaves the lists unchanged.
+
+[7] Stats() counts nodes as links, at sizeof(Node) each whatever their
+    fill, so BytesPerElement() shows how well N suits the list: it falls
+    towards sizeof(T) as nodes fill. Counting the nodes walks the node
+    chain, and the payload of a type with a PayloadBytes specialization
+    walks the elements too.
+*/
+
+#endif
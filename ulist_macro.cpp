@@ -0,0 +1,360 @@
+/*
+    ulist_macro.cpp
+    Andrew J Wood
+
+    slave file to ulist.h
+
+    Implementation of UnrolledList<T,N>:: macroscopic (whole list) mutators
+    Sort, Merge, Reverse, Shuffle, Splice
+*/
+
+//-----------------------------------
+//     node run support for Sort and Merge [6]
+//-----------------------------------
+
+template < typename T , size_t N >
+bool UnrolledList<T,N>::Reserve (Node *& spare, size_t count)
+// push count new nodes onto the chain spare; on failure nothing is kept
+{
+  for (size_t j = 0; j < count; ++j)
+  {
+    Node * m = NewNode();
+    if (m == nullptr)
+    {
+      Recycle(spare);
+      spare = nullptr;
+      return 0;
+    }
+    m->next_ = spare;
+    spare = m;
+  }
+  return 1;
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Recycle (Node * spare)
+// delete a chain of empty nodes
+{
+  while (spare != nullptr)
+  {
+    Node * next = spare->next_;
+    DeleteNode(spare);
+    spare = next;
+  }
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Attach (Node * chain)
+// hang the non-empty null-terminated chain between head_ and tail_, restoring prev_
+{
+  head_->next_ = chain;
+  chain->prev_ = head_;
+  Node * n;
+  for (n = chain; n->next_ != nullptr; n = n->next_)
+    n->next_->prev_ = n;
+  n->next_ = tail_;
+  tail_->prev_ = n;
+}
+
+template < typename T , size_t N >
+template < class P >
+void UnrolledList<T,N>::SortNode (Node * n, P& comp)
+// stable insertion sort of the elements of one node
+{
+  T * e = n->Elements();
+  for (size_t j = 1; j < n->count_; ++j)
+  {
+    if (!comp(e[j],e[j-1]))
+      continue;
+    T value(std::move(e[j]));
+    size_t k = j;
+    do
+    {
+      e[k] = std::move(e[k-1]);
+      --k;
+    }
+    while (k > 0 && comp(value,e[k-1]));
+    e[k] = std::move(value);
+  }
+}
+
+template < typename T , size_t N >
+template < class P >
+typename UnrolledList<T,N>::Node * UnrolledList<T,N>::MergeRuns (Node * a, Node * b, P& comp, Node *& spare)
+// merge the sorted null-terminated chains a and b into a chain of full nodes;
+// ties go to a. Emptied input nodes join spare, and output nodes come from
+// spare, which must hold at least two nodes on entry.
+{
+  Node * first = nullptr, * out = nullptr;
+  size_t ia = 0, ib = 0;
+  while (a != nullptr || b != nullptr)
+  {
+    bool fromB = (a == nullptr) || (b != nullptr && comp(b->Elements()[ib],a->Elements()[ia]));
+    Node *& src = fromB ? b : a;
+    size_t & is = fromB ? ib : ia;
+    if (out == nullptr || out->count_ == N)
+    {
+      Node * m = spare;
+      spare = spare->next_;
+      m->next_ = nullptr;
+      if (out == nullptr)
+        first = m;
+      else
+        out->next_ = m;
+      out = m;
+    }
+    T * e = src->Elements() + is;
+    new (out->data_ + out->count_) T(std::move(*e));
+    e->~T();
+    ++out->count_;
+    if (++is == src->count_) // src node used up
+    {
+      Node * done = src;
+      src = src->next_;
+      is = 0;
+      done->count_ = 0;
+      done->next_ = spare;
+      spare = done;
+    }
+  }
+  return first;
+}
+
+//-----------------------------------
+//     UnrolledList<T,N>::Sort Implementations
+//-----------------------------------
+
+template < typename T , size_t N >
+template < class P >
+void UnrolledList<T,N>::Sort (P& comp)
+// sort each node, then merge runs of nodes bottom-up: run[k] holds the
+// merge of 2^k nodes, and a new node carries upward like binary addition
+{
+  if (size_ < 2)
+    return;
+  Node * spare = nullptr;
+  if (!Reserve(spare,2))
+    return;
+
+  Node * run[64] = { nullptr };
+  size_t top = 0;  // run[0 .. top-1] in use
+  Node * chain = head_->next_;
+  tail_->prev_->next_ = nullptr;
+  while (chain != nullptr)
+  {
+    Node * carry = chain;
+    chain = chain->next_;
+    carry->next_ = nullptr;
+    SortNode(carry,comp);
+    size_t k = 0;
+    for ( ; k < top && run[k] != nullptr; ++k)
+    {
+      carry = MergeRuns(run[k],carry,comp,spare); // run[k] holds earlier elements
+      run[k] = nullptr;
+    }
+    run[k] = carry;
+    if (k == top)
+      ++top;
+  }
+  Node * sorted = nullptr;
+  for (size_t k = 0; k < top; ++k)
+  {
+    if (run[k] != nullptr)
+      sorted = (sorted == nullptr) ? run[k] : MergeRuns(run[k],sorted,comp,spare);
+  }
+  Attach(sorted);
+  Recycle(spare);
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Sort ()
+{
+  fsu::LessThan<T> p;
+  Sort(p);
+}
+
+//-----------------------------------
+//     UnrolledList<T,N>::Merge Implementations
+//-----------------------------------
+
+template < typename T , size_t N >
+template < class P >
+void UnrolledList<T,N>::Merge (UnrolledList<T,N>& y, P& p)
+// merges y into this list; post: y.Empty()
+// if both lists are ordered result is ordered
+{
+  if (this == &y || y.Empty()) return;
+  if (pool_ != y.pool_) // move y's elements into this list's arena first [2]
+  {
+    UnrolledList z(pool_);
+    z.Splice(z.End(),y);
+    Merge(z,p);
+    return;
+  }
+  Node * spare = nullptr;
+  if (!Reserve(spare,2))
+    return;
+
+  Node * x = nullptr;
+  if (head_->next_ != tail_)
+  {
+    x = head_->next_;
+    tail_->prev_->next_ = nullptr;
+  }
+  Node * z = y.head_->next_;
+  y.tail_->prev_->next_ = nullptr;
+  y.head_->next_ = y.tail_;
+  y.tail_->prev_ = y.head_;
+
+  Attach(MergeRuns(x,z,p,spare));
+  Recycle(spare);
+
+  // all of y's elements now belong to this list
+  size_ += y.size_;
+  y.size_ = 0;
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Merge (UnrolledList<T,N>& y)
+{
+  fsu::LessThan<T> p;
+  Merge(y,p);
+}
+
+//------------------------------------
+//     UnrolledList<T,N>::Reverse Implementation
+//------------------------------------
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Reverse ()
+// reverse the order of the nodes and the elements within each node
+{
+  if (head_->next_ == tail_)
+    return;
+
+  Node * node(head_), * temp(nullptr);
+  while (node != nullptr)
+  {
+    T * e = node->Elements();
+    for (size_t j = 0, k = node->count_; j + 1 < k; ++j, --k)
+      std::swap(e[j],e[k-1]);
+    temp        = node->next_;
+    node->next_ = node->prev_;
+    node->prev_ = temp;
+    node        = temp; // move to "old next" = node->prev_
+  }
+  // swap head_ and tail_
+  temp  = head_;
+  head_ = tail_;
+  tail_ = temp;
+}
+
+//------------------------------------
+//     UnrolledList<T,N>::Shuffle Implementation
+//------------------------------------
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Shuffle ()
+// the same permutation as List<T>::Shuffle: every 2nd and 3rd element, each
+// group in reverse order, ahead of the elements that stay in place
+{
+  if (size_ < 2)
+    return;
+  char toggle = 0;
+  UnrolledList aux0(pool_), aux1(pool_), aux2(pool_);
+  for (Node * n = head_->next_; n != tail_; n = n->next_)
+  {
+    T * e = n->Elements();
+    for (size_t k = 0; k < n->count_; ++k)
+    {
+      toggle == 2 ? toggle = 0 : toggle += 1;
+      if (toggle == 0)
+        aux0.PushBack(std::move(e[k]));
+      else if (toggle == 1)
+        aux1.PushFront(std::move(e[k]));
+      else
+        aux2.PushFront(std::move(e[k]));
+    }
+  }
+  Clear();
+  Splice(End(),aux1);
+  Splice(End(),aux2);
+  Splice(End(),aux0);
+}
+
+//------------------------------------
+//     UnrolledList<T,N>::Splice Implementations [4]
+//------------------------------------
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Splice (Iterator pos, UnrolledList<T,N>& y)
+// moves all elements of y ahead of pos; post: y.Empty()
+{
+  if (this == &y || y.Empty()) return;
+  Splice(pos,y,y.Begin(),y.End());
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Splice (Iterator pos, UnrolledList<T,N>& y, Iterator i)
+// moves the element at i in y ahead of pos
+{
+  if (!i.Valid() || i.node_ == y.head_ || i.node_ == y.tail_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  Iterator next = i;
+  ++next;
+  Splice(pos,y,i,next);
+}
+
+template < typename T , size_t N >
+void UnrolledList<T,N>::Splice (Iterator pos, UnrolledList<T,N>& y, Iterator first, Iterator last)
+// moves the elements of y in [first,last) ahead of pos
+{
+  if (!pos.Valid() || pos.node_ == head_ || !first.Valid() || !last.Valid() || first.node_ == y.head_)
+  {
+    std::cerr << "** List error: Splice() called with invalid iterator\n";
+    return;
+  }
+  if (first == last || pos == first || pos == last) return; // nothing to move, or already in place
+
+  if (pool_ != y.pool_) // move the elements one at a time into nodes from this pool
+  {
+    size_t n = 0;
+    for (ConstIterator j = first; j != last; ++j)
+      ++n;
+    while (n-- > 0)
+    {
+      pos = InsertAt(pos.node_, pos.index_, std::move(*first));
+      if (pos.node_ == tail_) return; // allocation failure
+      ++pos;
+      first = y.Erase(first.node_, first.index_);
+    }
+    return;
+  }
+
+  // make first, last and pos node boundaries, then relink the nodes [first,last)
+  if (!y.Split(first,last,pos) || !y.Split(last,first,pos) || !Split(pos,first,last))
+    return;
+  Node * front = first.node_, * back = last.node_->prev_, * before = front->prev_;
+  if (this != &y)
+  {
+    size_t n = 0;
+    for (Node * node = front; node != last.node_; node = node->next_)
+      n += node->count_;
+    size_ += n;
+    y.size_ -= n;
+  }
+  before->next_ = last.node_;
+  last.node_->prev_ = before;
+  front->prev_ = pos.node_->prev_;
+  back->next_ = pos.node_;
+  pos.node_->prev_->next_ = front;
+  pos.node_->prev_ = back;
+
+  // join sparse nodes at the three seams
+  y.Coalesce(before);
+  Coalesce(back);
+  Coalesce(front->prev_);
+}
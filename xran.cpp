@@ -57,6 +57,14 @@ namespace fsu
       Crank();
   }  
 
+  RandomBase::RandomBase(uint64_t seed) : word_(seed)
+  // constructor
+  // seeded by the client, so that the sequence can be repeated
+  {
+    for (size_t i = 0; i < 7; ++i) 
+      Crank();
+  }  
+
   // Marsaglia KISS 5
   void RandomBase::Crank()
   { 
@@ -72,6 +80,30 @@ namespace fsu
   }
   // KISS */
 
+  uint64_t RandomBase::Below(uint64_t n)
+  // returns random unsigned integer in [0,n), n > 0
+  // draws that would favor the low values are rejected, so every value is
+  // equally likely
+  {
+    if (n <= 0x0000000100000000)  // one 32-bit draw, scaled by n (Lemire)
+    {
+      uint64_t m = Get() * n;
+      if ((m & 0x00000000FFFFFFFF) < n)
+      {
+        uint64_t t = (0x0000000100000000 - n) % n;  // 2^32 mod n
+        while ((m & 0x00000000FFFFFFFF) < t)
+          m = Get() * n;
+      }
+      return m >> 32;
+    }
+    uint64_t t = (0 - n) % n;  // 2^64 mod n
+    uint64_t r;
+    do
+      r = (Get() << 32) | Get();
+    while (r < t);
+    return r % n;
+  }
+
   /* // Marsaglia Mixer
   void RandomBase::Crank()
   // This is the "multiply with carry" random generator of George Marsaglia,
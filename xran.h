@@ -22,6 +22,7 @@
     03/26/12: move to fixed width types defined in stdint.h
     11/11/13: go to C++ style C libraries
     04/04/15: added Random_uint32_t
+    10/17/26: RandomBase seed constructor and Below(n), for List::Shuffle
 
     about operator () ()
     --------------------
@@ -55,7 +56,9 @@ namespace fsu
   {
   public:
     RandomBase();
+    explicit RandomBase(uint64_t seed); // repeatable sequence for a given seed
     uint64_t Get();  // returns random unsigned 32-bit integer in a 64 bit register
+    uint64_t Below(uint64_t n); // returns random integer in [0,n), n > 0, without modulo bias
     uint64_t operator () () { return Get(); }
 
   private:
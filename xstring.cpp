@@ -211,6 +211,13 @@ namespace fsu
     Clone(S);
   }
 
+  String::String(String&& S)  :  data_(S.data_), size_(S.size_)
+  {
+    // Debug d("String move constructor");
+    S.data_ = nullptr;
+    S.size_ = 0;
+  }
+
   // String operators
 
   String& String::operator = (const String& S)
@@ -231,6 +238,18 @@ namespace fsu
     return *this;
   }
 
+  String& String::operator = (String&& S)
+  {
+    // Debug d("move assignment");
+    char*  data = data_;
+    size_t size = size_;
+    data_ = S.data_;
+    size_ = S.size_;
+    S.data_ = data;
+    S.size_ = size;
+    return *this;
+  }
+
   char& String::operator [] (size_t n)
   // overload of the array access operator
   // Note: [] returns a reference to the element, hence can be used on
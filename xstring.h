@@ -20,6 +20,7 @@
     01/13/07: style upgrade
     09/23/07: new(std::nothrow)
     01/01/09: style upgrade
+    10/17/26: std::hash<fsu::String>, so a String can key fsu::IndexedList
 
     Copyright 2009, R.C. Lacher
 */
@@ -28,7 +29,8 @@
 #define _XSTRING_H
 
 #include <iostream>
-#include <cstdlib> // size_t
+#include <cstdlib>    // size_t
+#include <functional> // std::hash
 
 namespace fsu
 {
@@ -51,9 +53,11 @@ namespace fsu
     String           (const char* cptr);           // construct a String around cptr
     ~String          ();                           // destructor
     String           (const String& s);            // copy constructor
+    String           (String&& s);                 // move constructor - s left null
  
     // operators
     String&      operator =   (const String& s);  // assignment operator
+    String&      operator =   (String&& s);       // move assignment - exchanges data
     char&        operator []  (size_t n) ;        // returns character n by ref
     const char&  operator []  (size_t n) const;   // const version
 
@@ -107,4 +111,25 @@ namespace fsu
 
 }   // namespace fsu
 
+namespace std
+{
+
+  // hash of the characters up to the first null, the ones operator ==
+  // compares (FNV-1a); the key of fsu::IndexedList<fsu::String> (list.h)
+  template <>
+  struct hash < fsu::String >
+  {
+    size_t operator () (const fsu::String& s) const
+    {
+      size_t h = 2166136261u;
+      const char * c = s.Cstr();
+      if (c != nullptr)
+        for ( ; *c != '\0'; ++c)
+          h = (h ^ static_cast<unsigned char>(*c)) * 16777619u;
+      return h;
+    }
+  } ;
+
+}   // namespace std
+
 #endif